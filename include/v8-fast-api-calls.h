@@ -158,6 +158,23 @@
  *  - uint64_t
  *  - float32_t
  *  - float64_t
+ *  - const FastApiTypedArray<T>&, where T is one of uint8_t, int32_t,
+ *    uint32_t, int64_t, uint64_t, float or double
+ *  - const FastOneByteString&
+ *
+ * Typed array arguments receive a (pointer, length) view of the backing
+ * store of a TypedArray whose element type matches T exactly (Uint8Array and
+ * Uint8ClampedArray for uint8_t, BigInt64Array for int64_t, etc.). String
+ * arguments receive a (pointer, length) view of a sequential one-byte string.
+ * The views are only valid for the duration of the fast call. If an argument
+ * does not have the expected shape (e.g. a detached typed array, a two-byte
+ * or a cons string), the slow callback is invoked instead.
+ *
+ * Several CFunction overloads can be registered for a single FunctionTemplate
+ * via FunctionTemplate::NewWithCFunctionOverloads. The optimizing compiler
+ * picks an overload whose argument count matches the call site and whose
+ * typed array/string parameters agree with the feedback for the arguments;
+ * if no overload matches, the slow callback is used.
  *
  * The 64-bit integer types currently have the IDL (unsigned) long long
  * semantics: https://heycam.github.io/webidl/#abstract-opdef-converttoint
@@ -197,6 +214,16 @@ class CTypeInfo {
     kFloat32,
     kFloat64,
     kV8Value,
+    // Only valid as the element type of a sequence, see SequenceType.
+    kUint8,
+  };
+
+  // Describes how a (pointer, length) sequence argument is passed, and thus
+  // which JS values are accepted for it. The element type is given by Type.
+  enum class SequenceType : uint8_t {
+    kScalar,
+    kIsTypedArray,     // const FastApiTypedArray<T>&
+    kIsOneByteString,  // const FastOneByteString&, element type kUint8
   };
 
   enum class ArgFlags : uint8_t {
@@ -218,6 +245,15 @@ class CTypeInfo {
         static_cast<int>(flags));
   }
 
+  static constexpr CTypeInfo FromCType(Type ctype, SequenceType sequence_type,
+                                       ArgFlags flags = ArgFlags::kNone) {
+    return CTypeInfo(
+        ((static_cast<uintptr_t>(ctype) << kTypeOffset) & kTypeMask) |
+        ((static_cast<uintptr_t>(sequence_type) << kSequenceTypeOffset) &
+         kSequenceTypeMask) |
+        static_cast<int>(flags));
+  }
+
   const void* GetWrapperInfo() const;
 
   constexpr Type GetType() const {
@@ -227,6 +263,14 @@ class CTypeInfo {
     return static_cast<Type>((payload_ & kTypeMask) >> kTypeOffset);
   }
 
+  constexpr SequenceType GetSequenceType() const {
+    if (payload_ & kIsWrapperTypeBit) {
+      return SequenceType::kScalar;
+    }
+    return static_cast<SequenceType>((payload_ & kSequenceTypeMask) >>
+                                     kSequenceTypeOffset);
+  }
+
   constexpr bool IsArray() const {
     return payload_ & static_cast<int>(ArgFlags::kIsArrayBit);
   }
@@ -249,6 +293,13 @@ class CTypeInfo {
   static constexpr uintptr_t kTypeMask =
       (~(static_cast<uintptr_t>(~0) << kTypeSize)) << kTypeOffset;
 
+  // Only used for non-wrapper types, whose payload has no pointer bits.
+  static constexpr unsigned int kSequenceTypeOffset = kTypeOffset + kTypeSize;
+  static constexpr unsigned int kSequenceTypeSize = 2;
+  static constexpr uintptr_t kSequenceTypeMask =
+      (~(static_cast<uintptr_t>(~0) << kSequenceTypeSize))
+      << kSequenceTypeOffset;
+
   const uintptr_t payload_;
 };
 
@@ -263,6 +314,25 @@ struct ApiObject {
   uintptr_t address;
 };
 
+/**
+ * A view of the backing store of a TypedArray passed to a fast API call.
+ * {length} is the number of elements, not bytes.
+ */
+template <typename T>
+struct FastApiTypedArray {
+  T* data;
+  size_t length;
+};
+
+/**
+ * A view of the characters of a sequential one-byte string passed to a fast
+ * API call. The data is not null-terminated.
+ */
+struct FastOneByteString {
+  const char* data;
+  uint32_t length;
+};
+
 namespace internal {
 
 template <typename T>
@@ -292,6 +362,23 @@ struct GetCType {
   V(ApiObject, kV8Value)
 
 SUPPORTED_C_TYPES(SPECIALIZE_GET_C_TYPE_FOR)
+SPECIALIZE_GET_C_TYPE_FOR(uint8_t, kUint8)
+
+template <typename T>
+struct GetCType<const FastApiTypedArray<T>&> {
+  static constexpr CTypeInfo Get() {
+    return CTypeInfo::FromCType(GetCType<T>::Get().GetType(),
+                                CTypeInfo::SequenceType::kIsTypedArray);
+  }
+};
+
+template <>
+struct GetCType<const FastOneByteString&> {
+  static constexpr CTypeInfo Get() {
+    return CTypeInfo::FromCType(CTypeInfo::Type::kUint8,
+                                CTypeInfo::SequenceType::kIsOneByteString);
+  }
+};
 
 // T* where T is a primitive (array of primitives).
 template <typename T, typename = void>
@@ -141,6 +141,7 @@ class LocalEmbedderHeapTracer;
 class MicrotaskQueue;
 class PropertyCallbackArguments;
 class ReadOnlyHeap;
+class BackgroundDeserializeTask;
 class ScopedExternalStringLock;
 struct ScriptStreamingData;
 class ThreadLocalTop;
@@ -1480,6 +1481,15 @@ class V8_EXPORT UnboundScript {
    */
   int GetLineNumber(int code_pos);
 
+  /**
+   * Returns the source positions of the functions of this script that have
+   * been compiled so far, eagerly or on their first call, in the form taken
+   * by ScriptCompiler::CompileHintCallback. Arrow functions and the top-level
+   * code are not included. Collected after startup, these are the hints that
+   * compile the same functions eagerly the next time the script is compiled.
+   */
+  std::vector<int> GetProducedCompileHints();
+
   static const int kNoScriptId = 0;
 };
 
@@ -1738,6 +1748,20 @@ class V8_EXPORT ScriptCompiler {
     CachedData& operator=(const CachedData&) = delete;
   };
 
+  class ConsumeCodeCacheTask;
+
+  /**
+   * Called while compiling a script for each function that V8 would otherwise
+   * compile lazily, with the source position of the function's parameter list
+   * and the data the callback was registered with. Returning true compiles
+   * the function eagerly. Functions nested in lazily compiled functions and
+   * arrow functions are not covered. The callback may be called on a
+   * background thread when the script is streamed. Scripts compiled with a
+   * callback neither use nor populate the isolate's compilation cache, so the
+   * hints are applied even if the same source was compiled before.
+   */
+  using CompileHintCallback = bool (*)(int position, void* data);
+
   /**
    * Source code which can be then compiled to a UnboundScript or Script.
    */
@@ -1748,6 +1772,16 @@ class V8_EXPORT ScriptCompiler {
                      CachedData* cached_data = nullptr);
     V8_INLINE Source(Local<String> source_string,
                      CachedData* cached_data = nullptr);
+    // Source takes ownership of CachedData and of the ConsumeCodeCacheTask,
+    // which must have been started for the same data and already run.
+    V8_INLINE Source(Local<String> source_string, const ScriptOrigin& origin,
+                     CachedData* cached_data,
+                     ConsumeCodeCacheTask* consume_cache_task);
+    // Functions for which |compile_hint_callback| returns true are compiled
+    // eagerly, see CompileHintCallback.
+    V8_INLINE Source(Local<String> source_string, const ScriptOrigin& origin,
+                     CompileHintCallback compile_hint_callback,
+                     void* compile_hint_callback_data);
     V8_INLINE ~Source();
 
     // Ownership of the CachedData or its buffers is *not* transferred to the
@@ -1778,6 +1812,10 @@ class V8_EXPORT ScriptCompiler {
     // set), or hold newly generated cache data (kProduce*Cache flags) are
     // set when calling a compile method.
     CachedData* cached_data;
+    std::unique_ptr<ConsumeCodeCacheTask> consume_cache_task;
+
+    CompileHintCallback compile_hint_callback = nullptr;
+    void* compile_hint_callback_data = nullptr;
   };
 
   /**
@@ -1874,6 +1912,26 @@ class V8_EXPORT ScriptCompiler {
     internal::ScriptStreamingData* data_;
   };
 
+  /**
+   * A task which the embedder may run on a background thread to deserialize
+   * a code cache ahead of compiling with kConsumeCodeCache. Returned by
+   * ScriptCompiler::StartConsumingCodeCache.
+   */
+  class V8_EXPORT ConsumeCodeCacheTask final {
+   public:
+    ~ConsumeCodeCacheTask();
+
+    void Run();
+
+   private:
+    friend class ScriptCompiler;
+
+    explicit ConsumeCodeCacheTask(
+        std::unique_ptr<internal::BackgroundDeserializeTask> impl);
+
+    std::unique_ptr<internal::BackgroundDeserializeTask> impl_;
+  };
+
   enum CompileOptions {
     kNoCompileOptions = 0,
     kConsumeCodeCache,
@@ -1950,8 +2008,24 @@ class V8_EXPORT ScriptCompiler {
   static ScriptStreamingTask* StartStreamingScript(
       Isolate* isolate, StreamedSource* source,
       CompileOptions options = kNoCompileOptions);
-  static ScriptStreamingTask* StartStreaming(Isolate* isolate,
-                                             StreamedSource* source);
+  static ScriptStreamingTask* StartStreaming(
+      Isolate* isolate, StreamedSource* source,
+      CompileHintCallback compile_hint_callback = nullptr,
+      void* compile_hint_callback_data = nullptr);
+
+  /**
+   * Returns a task which deserializes |cached_data| ahead of compilation. The
+   * user is responsible for running the task on a background thread, and for
+   * passing it to a Source, along with the same cached data, to be compiled
+   * with kConsumeCodeCache. Whether the data is accepted is only known then,
+   * as it is checked against the source string: compiling sets
+   * CachedData::rejected as usual.
+   *
+   * Most of the work of consuming a code cache happens on the background
+   * thread, leaving only a short finalization step to the main thread.
+   */
+  static ConsumeCodeCacheTask* StartConsumingCodeCache(
+      Isolate* isolate, std::unique_ptr<CachedData> cached_data);
 
   /**
    * Compiles a streamed script (bound to current context).
@@ -2037,6 +2111,40 @@ class V8_EXPORT ScriptCompiler {
    */
   static CachedData* CreateCodeCacheForFunction(Local<Function> function);
 
+  /**
+   * Merges the code cache |cached_data|, produced by CreateCodeCache for the
+   * same source, into unbound_script: functions that are compiled in the
+   * cache but still lazy in the script take over the cached bytecode without
+   * being compiled. Functions already compiled in the script are kept.
+   *
+   * CreateCodeCache always serializes everything compiled so far, so a cache
+   * can be grown incrementally by consuming it, merging newer caches into the
+   * resulting script and creating a new cache from it. Data produced by a
+   * different V8 version or for a different source is rejected: this returns
+   * false and sets |cached_data->rejected|, leaving the script unaffected.
+   */
+  static bool MergeCodeCache(Local<UnboundScript> unbound_script,
+                             CachedData* cached_data);
+
+  /**
+   * Creates and returns a feedback profile for the specified unbound_script.
+   * The profile records which functions of the script got hot in this
+   * process, so that a later process compiling the same source can preload
+   * it and tier up those functions early. Type feedback itself is not
+   * recorded, so preloaded functions still collect it afresh. The CachedData
+   * returned by this function should be owned by the caller.
+   */
+  static CachedData* CreateFeedbackProfile(Local<UnboundScript> unbound_script);
+
+  /**
+   * Preloads a feedback profile produced by CreateFeedbackProfile for the
+   * same source. Profiles produced by a different V8 version or for a
+   * different source are rejected: this returns false and sets
+   * |profile->rejected|, leaving the script unaffected.
+   */
+  static bool PreloadFeedbackProfile(Local<UnboundScript> unbound_script,
+                                     CachedData* profile);
+
  private:
   static V8_WARN_UNUSED_RESULT MaybeLocal<UnboundScript> CompileUnboundInternal(
       Isolate* isolate, Source* source, CompileOptions options,
@@ -4615,6 +4723,22 @@ class V8_EXPORT Function : public Object {
    */
   int ScriptId() const;
 
+  /**
+   * Returns how often optimized code for this function has been deoptimized
+   * eagerly (a speculative check failed) or softly (feedback was
+   * insufficient), saturating at 255. Returns zero if the function has no
+   * feedback yet. The count is shared with other closures
+   * that share this function's feedback.
+   */
+  int GetDeoptimizationCount() const;
+
+  /**
+   * Returns a description of the reason for the most recent deoptimization
+   * counted by GetDeoptimizationCount(), or nullptr if there was none. The
+   * string is statically allocated.
+   */
+  const char* GetLastDeoptimizationReason() const;
+
   /**
    * Returns the original function if this function is bound, else returns
    * v8::Undefined.
@@ -6557,6 +6681,19 @@ class V8_EXPORT FunctionTemplate : public Template {
       SideEffectType side_effect_type = SideEffectType::kHasSideEffect,
       const CFunction* c_function = nullptr);
 
+  /**
+   * Creates a function template for multiple overloaded fast API calls. The
+   * optimizing compiler picks the overload whose argument count and argument
+   * types match the call site; the slow callback is used for all other calls.
+   */
+  static Local<FunctionTemplate> NewWithCFunctionOverloads(
+      Isolate* isolate, FunctionCallback callback = nullptr,
+      Local<Value> data = Local<Value>(),
+      Local<Signature> signature = Local<Signature>(), int length = 0,
+      ConstructorBehavior behavior = ConstructorBehavior::kAllow,
+      SideEffectType side_effect_type = SideEffectType::kHasSideEffect,
+      const MemorySpan<const CFunction>& c_function_overloads = {});
+
   /**
    * Creates a function template backed/cached by a private property.
    */
@@ -6590,6 +6727,14 @@ class V8_EXPORT FunctionTemplate : public Template {
       SideEffectType side_effect_type = SideEffectType::kHasSideEffect,
       const CFunction* c_function = nullptr);
 
+  /**
+   * Same as above, but registers several overloaded fast API calls, see
+   * NewWithCFunctionOverloads.
+   */
+  void SetCallHandler(FunctionCallback callback, Local<Value> data,
+                      SideEffectType side_effect_type,
+                      const MemorySpan<const CFunction>& c_function_overloads);
+
   /** Set the predefined length property for the FunctionTemplate. */
   void SetLength(int length);
 
@@ -11469,6 +11614,33 @@ ScriptCompiler::Source::Source(Local<String> string,
                                CachedData* data)
     : source_string(string), cached_data(data) {}
 
+ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
+                               CachedData* data,
+                               ConsumeCodeCacheTask* consume_cache_task)
+    : source_string(string),
+      resource_name(origin.ResourceName()),
+      resource_line_offset(origin.ResourceLineOffset()),
+      resource_column_offset(origin.ResourceColumnOffset()),
+      resource_options(origin.Options()),
+      source_map_url(origin.SourceMapUrl()),
+      host_defined_options(origin.HostDefinedOptions()),
+      cached_data(data),
+      consume_cache_task(consume_cache_task) {}
+
+ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
+                               CompileHintCallback callback,
+                               void* callback_data)
+    : source_string(string),
+      resource_name(origin.ResourceName()),
+      resource_line_offset(origin.ResourceLineOffset()),
+      resource_column_offset(origin.ResourceColumnOffset()),
+      resource_options(origin.Options()),
+      source_map_url(origin.SourceMapUrl()),
+      host_defined_options(origin.HostDefinedOptions()),
+      cached_data(nullptr),
+      compile_hint_callback(callback),
+      compile_hint_callback_data(callback_data) {}
+
 
 ScriptCompiler::Source::~Source() {
   delete cached_data;
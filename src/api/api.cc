@@ -28,6 +28,7 @@
 #include "src/builtins/builtins-utils.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/cpu-features.h"
+#include "src/codegen/feedback-profile.h"
 #include "src/common/assert-scope.h"
 #include "src/common/external-pointer.h"
 #include "src/common/globals.h"
@@ -1423,7 +1424,7 @@ static Local<FunctionTemplate> FunctionTemplateNew(
     v8::Local<Signature> signature, int length, bool do_not_cache,
     v8::Local<Private> cached_property_name = v8::Local<Private>(),
     SideEffectType side_effect_type = SideEffectType::kHasSideEffect,
-    const CFunction* c_function = nullptr) {
+    const MemorySpan<const CFunction>& c_function_overloads = {}) {
   i::Handle<i::Struct> struct_obj = isolate->factory()->NewStruct(
       i::FUNCTION_TEMPLATE_INFO_TYPE, i::AllocationType::kOld);
   i::Handle<i::FunctionTemplateInfo> obj =
@@ -1442,7 +1443,7 @@ static Local<FunctionTemplate> FunctionTemplateNew(
   }
   if (callback != nullptr) {
     Utils::ToLocal(obj)->SetCallHandler(callback, data, side_effect_type,
-                                        c_function);
+                                        c_function_overloads);
   }
   obj->set_undetectable(false);
   obj->set_needs_access_check(false);
@@ -1466,9 +1467,30 @@ Local<FunctionTemplate> FunctionTemplate::New(
   // function templates when the isolate is created for serialization.
   LOG_API(i_isolate, FunctionTemplate, New);
   ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
-  auto templ =
-      FunctionTemplateNew(i_isolate, callback, data, signature, length, false,
-                          Local<Private>(), side_effect_type, c_function);
+  // Blink passes CFunction's constructed with the default constructor
+  // for non-fast calls, so we should check the address too.
+  const bool has_c_function =
+      c_function != nullptr && c_function->GetAddress() != nullptr;
+  auto templ = FunctionTemplateNew(
+      i_isolate, callback, data, signature, length, false, Local<Private>(),
+      side_effect_type,
+      has_c_function ? MemorySpan<const CFunction>(c_function, 1)
+                     : MemorySpan<const CFunction>());
+  if (behavior == ConstructorBehavior::kThrow) templ->RemovePrototype();
+  return templ;
+}
+
+Local<FunctionTemplate> FunctionTemplate::NewWithCFunctionOverloads(
+    Isolate* isolate, FunctionCallback callback, v8::Local<Value> data,
+    v8::Local<Signature> signature, int length, ConstructorBehavior behavior,
+    SideEffectType side_effect_type,
+    const MemorySpan<const CFunction>& c_function_overloads) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  LOG_API(i_isolate, FunctionTemplate, New);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  auto templ = FunctionTemplateNew(i_isolate, callback, data, signature,
+                                   length, false, Local<Private>(),
+                                   side_effect_type, c_function_overloads);
   if (behavior == ConstructorBehavior::kThrow) templ->RemovePrototype();
   return templ;
 }
@@ -1504,6 +1526,21 @@ void FunctionTemplate::SetCallHandler(FunctionCallback callback,
                                       v8::Local<Value> data,
                                       SideEffectType side_effect_type,
                                       const CFunction* c_function) {
+  // Blink passes CFunction's constructed with the default constructor
+  // for non-fast calls, so we should check the address too.
+  if (c_function != nullptr && c_function->GetAddress()) {
+    SetCallHandler(callback, data, side_effect_type,
+                   MemorySpan<const CFunction>(c_function, 1));
+  } else {
+    SetCallHandler(callback, data, side_effect_type,
+                   MemorySpan<const CFunction>());
+  }
+}
+
+void FunctionTemplate::SetCallHandler(
+    FunctionCallback callback, v8::Local<Value> data,
+    SideEffectType side_effect_type,
+    const MemorySpan<const CFunction>& c_function_overloads) {
   auto info = Utils::OpenHandle(this);
   EnsureNotInstantiated(info, "v8::FunctionTemplate::SetCallHandler");
   i::Isolate* isolate = info->GetIsolate();
@@ -1517,15 +1554,30 @@ void FunctionTemplate::SetCallHandler(FunctionCallback callback,
     data = v8::Undefined(reinterpret_cast<v8::Isolate*>(isolate));
   }
   obj->set_data(*Utils::OpenHandle(*data));
-  // Blink passes CFunction's constructed with the default constructor
-  // for non-fast calls, so we should check the address too.
-  if (c_function != nullptr && c_function->GetAddress()) {
+  if (c_function_overloads.size() > 0) {
+    const CFunction& first = c_function_overloads.data()[0];
     i::FunctionTemplateInfo::SetCFunction(
         isolate, info,
-        i::handle(*FromCData(isolate, c_function->GetAddress()), isolate));
+        i::handle(*FromCData(isolate, first.GetAddress()), isolate));
     i::FunctionTemplateInfo::SetCSignature(
         isolate, info,
-        i::handle(*FromCData(isolate, c_function->GetTypeInfo()), isolate));
+        i::handle(*FromCData(isolate, first.GetTypeInfo()), isolate));
+    int length = static_cast<int>(c_function_overloads.size());
+    i::Handle<i::FixedArray> overloads =
+        isolate->factory()->NewFixedArray(length * 2, i::AllocationType::kOld);
+    for (int i = 0; i < length; ++i) {
+      const CFunction& c_function = c_function_overloads.data()[i];
+      Utils::ApiCheck(c_function.GetAddress() != nullptr,
+                      "v8::FunctionTemplate::SetCallHandler",
+                      "Fast call overloads must not be empty CFunctions");
+      i::Handle<i::Object> address =
+          FromCData(isolate, c_function.GetAddress());
+      overloads->set(2 * i, *address);
+      i::Handle<i::Object> signature =
+          FromCData(isolate, c_function.GetTypeInfo());
+      overloads->set(2 * i + 1, *signature);
+    }
+    i::FunctionTemplateInfo::SetCFunctionOverloads(isolate, info, overloads);
   }
   info->set_call_code(*obj, kReleaseStore);
 }
@@ -2082,6 +2134,25 @@ int UnboundScript::GetLineNumber(int code_pos) {
   }
 }
 
+std::vector<int> UnboundScript::GetProducedCompileHints() {
+  i::Handle<i::SharedFunctionInfo> obj =
+      i::Handle<i::SharedFunctionInfo>::cast(Utils::OpenHandle(this));
+  i::Isolate* isolate = obj->GetIsolate();
+  std::vector<int> result;
+  if (!obj->script().IsScript()) return result;
+  i::DisallowGarbageCollection no_gc;
+  i::SharedFunctionInfo::ScriptIterator it(isolate,
+                                           i::Script::cast(obj->script()));
+  for (i::SharedFunctionInfo info = it.Next(); !info.is_null();
+       info = it.Next()) {
+    if (info.is_toplevel() || i::IsArrowFunction(info.kind())) continue;
+    if (!info.is_compiled()) continue;
+    result.push_back(info.StartPosition());
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
 Local<Value> UnboundScript::GetScriptName() {
   i::Handle<i::SharedFunctionInfo> obj =
       i::Handle<i::SharedFunctionInfo>::cast(Utils::OpenHandle(this));
@@ -2467,10 +2538,24 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
       isolate, source->resource_name, source->resource_line_offset,
       source->resource_column_offset, source->source_map_url,
       source->host_defined_options);
-  i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info =
-      i::Compiler::GetSharedFunctionInfoForScript(
-          isolate, str, script_details, source->resource_options, nullptr,
-          script_data, options, no_cache_reason, i::NOT_NATIVES_CODE);
+  i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info;
+  if (options == kConsumeCodeCache && source->consume_cache_task) {
+    maybe_function_info =
+        i::Compiler::GetSharedFunctionInfoForScriptWithDeserializeTask(
+            isolate, str, script_details, source->resource_options,
+            script_data, source->consume_cache_task->impl_.get(), options,
+            no_cache_reason, i::NOT_NATIVES_CODE);
+  } else if (options != kConsumeCodeCache && source->compile_hint_callback) {
+    maybe_function_info =
+        i::Compiler::GetSharedFunctionInfoForScriptWithCompileHints(
+            isolate, str, script_details, source->resource_options,
+            source->compile_hint_callback, source->compile_hint_callback_data,
+            options, no_cache_reason, i::NOT_NATIVES_CODE);
+  } else {
+    maybe_function_info = i::Compiler::GetSharedFunctionInfoForScript(
+        isolate, str, script_details, source->resource_options, nullptr,
+        script_data, options, no_cache_reason, i::NOT_NATIVES_CODE);
+  }
   if (options == kConsumeCodeCache) {
     source->cached_data->rejected = script_data->rejected();
   }
@@ -2642,16 +2727,36 @@ ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
 }
 
 ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreaming(
-    Isolate* v8_isolate, StreamedSource* source) {
+    Isolate* v8_isolate, StreamedSource* source,
+    CompileHintCallback compile_hint_callback,
+    void* compile_hint_callback_data) {
   if (!i::FLAG_script_streaming) return nullptr;
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   i::ScriptStreamingData* data = source->impl();
   std::unique_ptr<i::BackgroundCompileTask> task =
       std::make_unique<i::BackgroundCompileTask>(data, isolate);
+  task->SetCompileHintCallback(compile_hint_callback,
+                               compile_hint_callback_data);
   data->task = std::move(task);
   return new ScriptCompiler::ScriptStreamingTask(data);
 }
 
+ScriptCompiler::ConsumeCodeCacheTask::ConsumeCodeCacheTask(
+    std::unique_ptr<i::BackgroundDeserializeTask> impl)
+    : impl_(std::move(impl)) {}
+
+ScriptCompiler::ConsumeCodeCacheTask::~ConsumeCodeCacheTask() = default;
+
+void ScriptCompiler::ConsumeCodeCacheTask::Run() { impl_->Run(); }
+
+ScriptCompiler::ConsumeCodeCacheTask* ScriptCompiler::StartConsumingCodeCache(
+    Isolate* v8_isolate, std::unique_ptr<CachedData> cached_data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  return new ScriptCompiler::ConsumeCodeCacheTask(
+      std::make_unique<i::BackgroundDeserializeTask>(isolate,
+                                                     std::move(cached_data)));
+}
+
 MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
                                            StreamedSource* v8_source,
                                            Local<String> full_source_string,
@@ -2720,6 +2825,47 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheForFunction(
   return i::CodeSerializer::Serialize(shared);
 }
 
+bool ScriptCompiler::MergeCodeCache(Local<UnboundScript> unbound_script,
+                                    CachedData* cached_data) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  i::Isolate* isolate = shared->GetIsolate();
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  i::Handle<i::Script> script(i::Script::cast(shared->script()), isolate);
+  // ScriptData takes care of pointer-aligning the data.
+  i::ScriptData script_data(cached_data->data, cached_data->length);
+  bool accepted =
+      i::CodeSerializer::MergeIntoScript(isolate, &script_data, script);
+  cached_data->rejected = script_data.rejected();
+  return accepted;
+}
+
+ScriptCompiler::CachedData* ScriptCompiler::CreateFeedbackProfile(
+    Local<UnboundScript> unbound_script) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  i::Isolate* isolate = shared->GetIsolate();
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  i::Handle<i::Script> script(i::Script::cast(shared->script()), isolate);
+  return i::FeedbackProfile::Serialize(isolate, script);
+}
+
+bool ScriptCompiler::PreloadFeedbackProfile(Local<UnboundScript> unbound_script,
+                                            CachedData* profile) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  i::Isolate* isolate = shared->GetIsolate();
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  i::Handle<i::Script> script(i::Script::cast(shared->script()), isolate);
+  bool accepted = i::FeedbackProfile::Preload(isolate, script, profile->data,
+                                              profile->length);
+  profile->rejected = !accepted;
+  return accepted;
+}
+
 MaybeLocal<Script> Script::Compile(Local<Context> context, Local<String> source,
                                    ScriptOrigin* origin) {
   if (origin) {
@@ -5117,6 +5263,24 @@ int Function::ScriptId() const {
   return script->id();
 }
 
+int Function::GetDeoptimizationCount() const {
+  auto self = Utils::OpenHandle(this);
+  if (!self->IsJSFunction()) return 0;
+  auto func = i::Handle<i::JSFunction>::cast(self);
+  if (!func->has_feedback_vector()) return 0;
+  return func->feedback_vector().deopt_count();
+}
+
+const char* Function::GetLastDeoptimizationReason() const {
+  auto self = Utils::OpenHandle(this);
+  if (!self->IsJSFunction()) return nullptr;
+  auto func = i::Handle<i::JSFunction>::cast(self);
+  if (!func->has_feedback_vector()) return nullptr;
+  i::FeedbackVector vector = func->feedback_vector();
+  if (vector.deopt_count() == 0) return nullptr;
+  return i::DeoptimizeReasonToString(vector.last_deopt_reason());
+}
+
 Local<v8::Value> Function::GetBoundFunction() const {
   auto self = Utils::OpenHandle(this);
   if (self->IsJSBoundFunction()) {
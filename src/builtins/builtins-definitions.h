@@ -96,6 +96,9 @@ namespace internal {
   TFS(FastNewClosure, kSharedFunctionInfo, kFeedbackCell)                      \
   /* ES6 section 9.5.14 [[Construct]] ( argumentsList, newTarget) */           \
   TFC(ConstructProxy, JSTrampoline)                                            \
+  /* Lazy deopt continuations for TurboFan-inlined proxy [[Get]]/[[Set]] */    \
+  TFC(ProxyGetPropertyLazyDeoptContinuation, ProxyGetPropertyStackParameter)   \
+  TFC(ProxySetPropertyLazyDeoptContinuation, ProxySetPropertyStackParameter)   \
                                                                                \
   /* Apply and entries */                                                      \
   ASM(JSEntry, Dummy)                                                          \
@@ -812,6 +815,9 @@ namespace internal {
   TFC(WasmI32AtomicWait32, WasmI32AtomicWait32)                                \
   TFC(WasmI64AtomicWait32, WasmI64AtomicWait32)                                \
   TFS(WasmAllocatePair, kValue1, kValue2)                                      \
+  /* Continuation for a lazy deopt at an inlined JS to Wasm call. Requires */  \
+  /* its parameter on the stack. */                                            \
+  TFC(JSToWasmLazyDeoptContinuation, TypeConversionStackParameter)             \
                                                                                \
   /* WeakMap */                                                                \
   TFJ(WeakMapConstructor, kDontAdaptArgumentsSentinel)                         \
@@ -206,6 +206,45 @@ TF_BUILTIN(ConstructProxy, ProxiesCodeStubAssembler) {
   { ThrowTypeError(context, MessageTemplate::kProxyRevoked, "construct"); }
 }
 
+// Resumes a proxy [[Get]] that TurboFan inlined as a direct call to the "get"
+// trap when the optimized code was deoptimized while the trap was running.
+// Performs the invariant check on the trap result that the optimized code
+// would have done.
+TF_BUILTIN(ProxyGetPropertyLazyDeoptContinuation, ProxiesCodeStubAssembler) {
+  auto context = Parameter<Context>(Descriptor::kContext);
+  auto proxy = Parameter<JSProxy>(Descriptor::kProxy);
+  auto target = Parameter<JSReceiver>(Descriptor::kTarget);
+  auto name = Parameter<Name>(Descriptor::kName);
+  auto trap_result = Parameter<Object>(Descriptor::kResult);
+
+  CheckGetSetTrapResult(context, target, proxy, name, trap_result,
+                        JSProxy::kGet);
+  Return(trap_result);
+}
+
+// Same as above for an inlined call to the "set" trap.
+TF_BUILTIN(ProxySetPropertyLazyDeoptContinuation, ProxiesCodeStubAssembler) {
+  auto context = Parameter<Context>(Descriptor::kContext);
+  auto proxy = Parameter<JSProxy>(Descriptor::kProxy);
+  auto target = Parameter<JSReceiver>(Descriptor::kTarget);
+  auto name = Parameter<Name>(Descriptor::kName);
+  auto value = Parameter<Object>(Descriptor::kValue);
+  auto trap_result = Parameter<Object>(Descriptor::kResult);
+
+  Label if_true(this), if_false(this, Label::kDeferred);
+  BranchIfToBooleanIsTrue(trap_result, &if_true, &if_false);
+
+  BIND(&if_true);
+  CheckGetSetTrapResult(context, target, proxy, name, value, JSProxy::kSet);
+  Return(value);
+
+  BIND(&if_false);
+  CallRuntime(Runtime::kThrowTypeErrorIfStrict, context,
+              SmiConstant(MessageTemplate::kProxyTrapReturnedFalsishFor),
+              StringConstant("set"), name);
+  Return(value);
+}
+
 void ProxiesCodeStubAssembler::CheckGetSetTrapResult(
     TNode<Context> context, TNode<JSReceiver> target, TNode<JSProxy> proxy,
     TNode<Name> name, TNode<Object> trap_result,
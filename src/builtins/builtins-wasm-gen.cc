@@ -53,6 +53,22 @@ TF_BUILTIN(WasmFloat64ToNumber, WasmBuiltinsAssembler) {
   Return(ChangeFloat64ToTagged(val));
 }
 
+// Requires parameter on stack so that it can be used as a continuation from a
+// LAZY deopt. The deoptimizer already converted the result of the Wasm call to
+// a JavaScript value, but the optimized code never got to reset the
+// thread-in-wasm flag it set before the call.
+TF_BUILTIN(JSToWasmLazyDeoptContinuation, WasmBuiltinsAssembler) {
+  TNode<RawPtrT> thread_in_wasm_flag_address = ReinterpretCast<RawPtrT>(
+      Load(MachineType::Pointer(),
+           ExternalConstant(ExternalReference::isolate_root(isolate())),
+           IntPtrConstant(Isolate::thread_in_wasm_flag_address_offset())));
+  StoreNoWriteBarrier(MachineRepresentation::kWord32,
+                      thread_in_wasm_flag_address, Int32Constant(0));
+
+  auto value = Parameter<Object>(Descriptor::kArgument);
+  Return(value);
+}
+
 TF_BUILTIN(WasmI32AtomicWait32, WasmBuiltinsAssembler) {
   if (!Is32()) {
     Unreachable();
@@ -13,6 +13,7 @@
 #include "src/ast/scopes.h"
 #include "src/base/logging.h"
 #include "src/base/optional.h"
+#include "src/base/platform/mutex.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -38,6 +39,7 @@
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/local-heap.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/v8.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/log-inl.h"
 #include "src/objects/feedback-cell-inl.h"
@@ -695,6 +697,162 @@ bool RecursivelyExecuteUnoptimizedCompilationJobs(
   return true;
 }
 
+// The eager inner function literals of a background compile that still have
+// to be compiled, and the jobs of those already compiled. Compiling a literal
+// can discover further eager inner literals, which are added back to the
+// worklist.
+class EagerInnerFunctionWorklist {
+ public:
+  EagerInnerFunctionWorklist(ParseInfo* parse_info,
+                             AccountingAllocator* allocator)
+      : parse_info_(parse_info), allocator_(allocator) {}
+  EagerInnerFunctionWorklist(const EagerInnerFunctionWorklist&) = delete;
+  EagerInnerFunctionWorklist& operator=(const EagerInnerFunctionWorklist&) =
+      delete;
+
+  // Adds |literals| to the worklist. Returns true if any of them can be
+  // compiled by a worker.
+  bool Add(const std::vector<FunctionLiteral*>& literals) {
+    base::MutexGuard guard(&mutex_);
+    return AddLocked(literals);
+  }
+
+  // Compiles literals until the worklist is empty, compilation fails or
+  // |delegate| asks to yield.
+  void Run(JobDelegate* delegate) {
+    // The stack limit of |parse_info_| belongs to the thread that parsed.
+    uintptr_t stack_limit = GetCurrentStackPosition() - FLAG_stack_size * KB;
+    while (FunctionLiteral* literal = Next()) {
+      std::vector<FunctionLiteral*> eager_inner_literals;
+      std::unique_ptr<UnoptimizedCompilationJob> job =
+          interpreter::Interpreter::NewCompilationJob(
+              parse_info_, literal, stack_limit, allocator_,
+              &eager_inner_literals);
+      bool succeeded = job->ExecuteJob() == CompilationJob::SUCCEEDED;
+
+      bool added_literals = false;
+      {
+        base::MutexGuard guard(&mutex_);
+        if (succeeded) {
+          jobs_.emplace_front(std::move(job));
+          added_literals = AddLocked(eager_inner_literals);
+        } else {
+          failed_ = true;
+          outstanding_literals_.fetch_sub(pending_literals_.size(),
+                                          std::memory_order_relaxed);
+          pending_literals_.clear();
+        }
+        outstanding_literals_.fetch_sub(1, std::memory_order_relaxed);
+      }
+      if (added_literals) delegate->NotifyConcurrencyIncrease();
+      if (delegate->ShouldYield()) return;
+    }
+  }
+
+  // Includes the literals that are currently being compiled.
+  size_t outstanding_literals() const {
+    return outstanding_literals_.load(std::memory_order_relaxed);
+  }
+
+  // Only valid once all workers are done.
+  bool failed() const { return failed_; }
+  UnoptimizedCompilationJobList* jobs() { return &jobs_; }
+  const std::vector<FunctionLiteral*>& asm_wasm_literals() const {
+    return asm_wasm_literals_;
+  }
+
+ private:
+  bool AddLocked(const std::vector<FunctionLiteral*>& literals) {
+    if (failed_) return false;
+    bool added = false;
+    for (FunctionLiteral* literal : literals) {
+      // asm.js validation reads the shared character stream, so asm.js
+      // candidates are compiled by the thread owning |parse_info_|.
+      if (UseAsmWasm(literal, parse_info_->flags().is_asm_wasm_broken())) {
+        asm_wasm_literals_.push_back(literal);
+        continue;
+      }
+      pending_literals_.push_back(literal);
+      outstanding_literals_.fetch_add(1, std::memory_order_relaxed);
+      added = true;
+    }
+    return added;
+  }
+
+  FunctionLiteral* Next() {
+    base::MutexGuard guard(&mutex_);
+    if (pending_literals_.empty()) return nullptr;
+    FunctionLiteral* literal = pending_literals_.back();
+    pending_literals_.pop_back();
+    return literal;
+  }
+
+  ParseInfo* const parse_info_;
+  AccountingAllocator* const allocator_;
+  base::Mutex mutex_;
+  std::vector<FunctionLiteral*> pending_literals_;
+  std::vector<FunctionLiteral*> asm_wasm_literals_;
+  std::atomic<size_t> outstanding_literals_{0};
+  UnoptimizedCompilationJobList jobs_;
+  bool failed_ = false;
+};
+
+class EagerInnerFunctionCompileJob final : public JobTask {
+ public:
+  explicit EagerInnerFunctionCompileJob(EagerInnerFunctionWorklist* worklist)
+      : worklist_(worklist) {}
+
+  void Run(JobDelegate* delegate) override {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                 "V8.CompileEagerInnerFunctionsBackground");
+    worklist_->Run(delegate);
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    // The outstanding literals include those currently being compiled, so
+    // the {worker_count} can be ignored.
+    return worklist_->outstanding_literals();
+  }
+
+ private:
+  EagerInnerFunctionWorklist* const worklist_;
+};
+
+// Like RecursivelyExecuteUnoptimizedCompilationJobs, but compiles the eager
+// inner functions of |parse_info|'s literal in parallel on worker threads.
+// The calling thread contributes to the work and only returns once all of it
+// is done, so the jobs can be finalized on the main thread as usual.
+bool ExecuteUnoptimizedCompilationJobsInParallel(
+    ParseInfo* parse_info, AccountingAllocator* allocator,
+    UnoptimizedCompilationJobList* function_jobs) {
+  std::vector<FunctionLiteral*> eager_inner_literals;
+  std::unique_ptr<UnoptimizedCompilationJob> outer_job =
+      ExecuteSingleUnoptimizedCompilationJob(parse_info, parse_info->literal(),
+                                             allocator, &eager_inner_literals);
+  if (!outer_job) return false;
+
+  EagerInnerFunctionWorklist worklist(parse_info, allocator);
+  if (worklist.Add(eager_inner_literals)) {
+    std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserVisible,
+        std::make_unique<EagerInnerFunctionCompileJob>(&worklist));
+    job_handle->Join();
+  }
+  if (worklist.failed()) return false;
+
+  UnoptimizedCompilationJobList* jobs = worklist.jobs();
+  for (FunctionLiteral* literal : worklist.asm_wasm_literals()) {
+    if (!RecursivelyExecuteUnoptimizedCompilationJobs(parse_info, literal,
+                                                      allocator, jobs)) {
+      return false;
+    }
+  }
+
+  jobs->emplace_front(std::move(outer_job));
+  function_jobs->splice_after(function_jobs->before_begin(), *jobs);
+  return true;
+}
+
 template <typename LocalIsolate>
 bool IterativelyExecuteAndFinalizeUnoptimizedCompilationJobs(
     LocalIsolate* isolate, Handle<SharedFunctionInfo> outer_shared_info,
@@ -846,6 +1004,23 @@ V8_WARN_UNUSED_RESULT MaybeHandle<Code> GetCodeFromOptimizedCodeCache(
     feedback_vector.EvictOptimizedCodeMarkedForDeoptimization(
         function->shared(), "GetCodeFromOptimizedCodeCache");
     code = feedback_vector.optimized_code();
+    if (code.is_null() && FLAG_turbo_share_optimized_code) {
+      // Closures of the same function that don't share a feedback vector can
+      // still share optimized code within a native context. The code doesn't
+      // depend on the feedback it was compiled with for correctness, and will
+      // deoptimize if its assumptions don't hold for this closure. Code that
+      // refers to the feedback of its closure is never cached there.
+      Code shared_code = function->context()
+                             .native_context()
+                             .GetOSROptimizedCodeCache()
+                             .GetOptimizedCode(shared, osr_offset, isolate);
+      if (!shared_code.is_null() && shared_code.kind() == code_kind) {
+        code = shared_code;
+        feedback_vector.ClearOptimizationMarker();
+        FeedbackVector::SetOptimizedCode(handle(feedback_vector, isolate),
+                                         handle(code, isolate));
+      }
+    }
   } else if (!osr_offset.IsNone()) {
     code = function->context()
                .native_context()
@@ -874,6 +1049,34 @@ void ClearOptimizedCodeCache(OptimizedCompilationInfo* compilation_info) {
   }
 }
 
+// Returns true if {code} refers to objects that hold the feedback of the
+// closure it was compiled for, like its feedback vector, the feedback cells of
+// inner closures or allocation sites, or to functions, which are usually call
+// targets taken from that feedback. Such code must not be shared with other
+// closures: their feedback would otherwise be mixed in, or they would deopt
+// on a different call target and throw the code away for all closures.
+bool EmbedsClosureFeedback(Code code) {
+  DisallowHeapAllocation no_gc;
+  auto is_closure_feedback = [](Object object) {
+    return object.IsFeedbackVector() || object.IsFeedbackCell() ||
+           object.IsClosureFeedbackCellArray() || object.IsAllocationSite() ||
+           object.IsJSFunction();
+  };
+  for (RelocIterator it(code, RelocInfo::EmbeddedObjectModeMask()); !it.done();
+       it.next()) {
+    if (is_closure_feedback(it.rinfo()->target_object())) return true;
+  }
+  // The deoptimizer also updates feedback via the literal array.
+  DeoptimizationData data =
+      DeoptimizationData::cast(code.deoptimization_data());
+  if (data.length() == 0) return false;
+  FixedArray literals = data.LiteralArray();
+  for (int i = 0; i < literals.length(); ++i) {
+    if (is_closure_feedback(literals.get(i))) return true;
+  }
+  return false;
+}
+
 void InsertCodeIntoOptimizedCodeCache(
     OptimizedCompilationInfo* compilation_info) {
   const CodeKind kind = compilation_info->code_kind();
@@ -901,6 +1104,11 @@ void InsertCodeIntoOptimizedCodeCache(
     Handle<FeedbackVector> vector =
         handle(function->feedback_vector(), function->GetIsolate());
     FeedbackVector::SetOptimizedCode(vector, code);
+    if (FLAG_turbo_share_optimized_code && shared->shares_optimized_code() &&
+        !EmbedsClosureFeedback(*code)) {
+      OSROptimizedCodeCache::AddOptimizedCode(native_context, shared, code,
+                                              BailoutId::None());
+    }
   } else {
     DCHECK(CodeKindCanOSR(kind));
     OSROptimizedCodeCache::AddOptimizedCode(native_context, shared, code,
@@ -1405,8 +1613,17 @@ void CompileOnBackgroundThread(ParseInfo* parse_info,
   // Generate the unoptimized bytecode or asm-js data.
   DCHECK(jobs->empty());
 
-  bool success = RecursivelyExecuteUnoptimizedCompilationJobs(
-      parse_info, parse_info->literal(), allocator, jobs);
+  // Worker threads cannot share the runtime call stats of |parse_info|, so
+  // compile sequentially while they are being collected.
+  bool success;
+  if (FLAG_parallel_compile_eager_inner_functions &&
+      !TracingFlags::is_runtime_stats_enabled()) {
+    success = ExecuteUnoptimizedCompilationJobsInParallel(parse_info,
+                                                          allocator, jobs);
+  } else {
+    success = RecursivelyExecuteUnoptimizedCompilationJobs(
+        parse_info, parse_info->literal(), allocator, jobs);
+  }
 
   USE(success);
   DCHECK_EQ(success, !jobs->empty());
@@ -1497,6 +1714,10 @@ BackgroundCompileTask::BackgroundCompileTask(
 
   DCHECK(!function_literal->is_toplevel());
 
+  info_->set_compile_hint_callback(
+      outer_parse_info->compile_hint_callback(),
+      outer_parse_info->compile_hint_callback_data());
+
   // Clone the character stream so both can be accessed independently.
   std::unique_ptr<Utf16CharacterStream> character_stream =
       outer_parse_info->character_stream()->Clone();
@@ -1514,6 +1735,12 @@ BackgroundCompileTask::BackgroundCompileTask(
 
 BackgroundCompileTask::~BackgroundCompileTask() = default;
 
+void BackgroundCompileTask::SetCompileHintCallback(
+    ScriptCompiler::CompileHintCallback callback, void* data) {
+  info()->set_compile_hint_callback(callback, data);
+  has_compile_hints_ = callback != nullptr;
+}
+
 namespace {
 
 // A scope object that ensures a parse info's runtime call stats and stack limit
@@ -1644,6 +1871,35 @@ Handle<Script> BackgroundCompileTask::GetScript(Isolate* isolate) {
   return handle(*script_, isolate);
 }
 
+BackgroundDeserializeTask::BackgroundDeserializeTask(
+    Isolate* isolate, std::unique_ptr<ScriptCompiler::CachedData> data)
+    : isolate_for_local_isolate_(isolate),
+      data_(std::move(data)),
+      // ScriptData takes care of pointer-aligning the data.
+      script_data_(data_->data, data_->length) {}
+
+void BackgroundDeserializeTask::Run() {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "BackgroundDeserializeTask::Run");
+  LocalIsolate local_isolate(isolate_for_local_isolate_,
+                             ThreadKind::kBackground);
+  UnparkedScope unparked_scope(local_isolate.heap());
+  LocalHandleScope handle_scope(&local_isolate);
+  off_thread_data_ =
+      CodeSerializer::StartDeserializeOffThread(&local_isolate, &script_data_);
+}
+
+MaybeHandle<SharedFunctionInfo> BackgroundDeserializeTask::Finish(
+    Isolate* isolate, ScriptData* cached_data, Handle<String> source,
+    ScriptOriginOptions origin_options) {
+  MaybeHandle<SharedFunctionInfo> result =
+      CodeSerializer::FinishOffThreadDeserialize(
+          isolate, std::move(off_thread_data_), &script_data_, source,
+          origin_options);
+  if (script_data_.rejected()) cached_data->Reject();
+  return result;
+}
+
 // ----------------------------------------------------------------------------
 // Implementation of Compiler
 
@@ -2490,10 +2746,14 @@ MaybeHandle<SharedFunctionInfo> CompileScriptOnMainThread(
     const Compiler::ScriptDetails& script_details,
     ScriptOriginOptions origin_options, NativesFlag natives,
     v8::Extension* extension, Isolate* isolate,
-    IsCompiledScope* is_compiled_scope) {
+    IsCompiledScope* is_compiled_scope,
+    ScriptCompiler::CompileHintCallback compile_hint_callback = nullptr,
+    void* compile_hint_callback_data = nullptr) {
   UnoptimizedCompileState compile_state(isolate);
   ParseInfo parse_info(isolate, flags, &compile_state);
   parse_info.set_extension(extension);
+  parse_info.set_compile_hint_callback(compile_hint_callback,
+                                       compile_hint_callback_data);
 
   Handle<Script> script = NewScript(isolate, &parse_info, source,
                                     script_details, origin_options, natives);
@@ -2636,21 +2896,28 @@ MaybeHandle<SharedFunctionInfo> CompileScriptOnBothBackgroundAndMainThread(
 }  // namespace
 
 // static
-MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
+namespace {
+
+MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     Isolate* isolate, Handle<String> source,
     const Compiler::ScriptDetails& script_details,
     ScriptOriginOptions origin_options, v8::Extension* extension,
-    ScriptData* cached_data, ScriptCompiler::CompileOptions compile_options,
+    ScriptData* cached_data, BackgroundDeserializeTask* deserialize_task,
+    ScriptCompiler::CompileHintCallback compile_hint_callback,
+    void* compile_hint_callback_data,
+    ScriptCompiler::CompileOptions compile_options,
     ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
   ScriptCompileTimerScope compile_timer(isolate, no_cache_reason);
 
   if (compile_options == ScriptCompiler::kNoCompileOptions ||
       compile_options == ScriptCompiler::kEagerCompile) {
     DCHECK_NULL(cached_data);
+    DCHECK_NULL(deserialize_task);
   } else {
     DCHECK(compile_options == ScriptCompiler::kConsumeCodeCache);
     DCHECK(cached_data);
     DCHECK_NULL(extension);
+    DCHECK_NULL(compile_hint_callback);
   }
   int source_length = source->length();
   isolate->counters()->total_load_size()->Increment(source_length);
@@ -2659,10 +2926,12 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
   LanguageMode language_mode = construct_language_mode(FLAG_use_strict);
   CompilationCache* compilation_cache = isolate->compilation_cache();
 
-  // For extensions or REPL mode scripts neither do a compilation cache lookup,
-  // nor put the compilation result back into the cache.
+  // For extensions, REPL mode scripts or scripts with compile hints neither do
+  // a compilation cache lookup, nor put the compilation result back into the
+  // cache. A cached script would ignore the hints.
   const bool use_compilation_cache =
-      extension == nullptr && script_details.repl_mode == REPLMode::kNo;
+      extension == nullptr && script_details.repl_mode == REPLMode::kNo &&
+      compile_hint_callback == nullptr;
   MaybeHandle<SharedFunctionInfo> maybe_result;
   IsCompiledScope is_compiled_scope;
   if (use_compilation_cache) {
@@ -2688,9 +2957,13 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
       TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                    "V8.CompileDeserialize");
       Handle<SharedFunctionInfo> inner_result;
-      if (CodeSerializer::Deserialize(isolate, cached_data, source,
-                                      origin_options)
-              .ToHandle(&inner_result) &&
+      MaybeHandle<SharedFunctionInfo> maybe_inner_result =
+          deserialize_task
+              ? deserialize_task->Finish(isolate, cached_data, source,
+                                         origin_options)
+              : CodeSerializer::Deserialize(isolate, cached_data, source,
+                                            origin_options);
+      if (maybe_inner_result.ToHandle(&inner_result) &&
           inner_result->is_compiled()) {
         // Promote to per-isolate compilation cache.
         is_compiled_scope = inner_result->is_compiled_scope(isolate);
@@ -2708,7 +2981,7 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
 
   if (maybe_result.is_null()) {
     // No cache entry found compile the script.
-    if (FLAG_stress_background_compile &&
+    if (FLAG_stress_background_compile && compile_hint_callback == nullptr &&
         CanBackgroundCompile(script_details, origin_options, extension,
                              compile_options, natives)) {
       // If the --stress-background-compile flag is set, do the actual
@@ -2726,7 +2999,8 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
 
       maybe_result = CompileScriptOnMainThread(
           flags, source, script_details, origin_options, natives, extension,
-          isolate, &is_compiled_scope);
+          isolate, &is_compiled_scope, compile_hint_callback,
+          compile_hint_callback_data);
     }
 
     // Add the result to the isolate cache.
@@ -2743,6 +3017,54 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
   return maybe_result;
 }
 
+}  // namespace
+
+// static
+MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
+    Isolate* isolate, Handle<String> source,
+    const Compiler::ScriptDetails& script_details,
+    ScriptOriginOptions origin_options, v8::Extension* extension,
+    ScriptData* cached_data, ScriptCompiler::CompileOptions compile_options,
+    ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
+  return GetSharedFunctionInfoForScriptImpl(
+      isolate, source, script_details, origin_options, extension, cached_data,
+      nullptr, nullptr, nullptr, compile_options, no_cache_reason, natives);
+}
+
+// static
+MaybeHandle<SharedFunctionInfo>
+Compiler::GetSharedFunctionInfoForScriptWithCompileHints(
+    Isolate* isolate, Handle<String> source,
+    const Compiler::ScriptDetails& script_details,
+    ScriptOriginOptions origin_options,
+    ScriptCompiler::CompileHintCallback compile_hint_callback,
+    void* compile_hint_callback_data,
+    ScriptCompiler::CompileOptions compile_options,
+    ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
+  DCHECK_NOT_NULL(compile_hint_callback);
+  return GetSharedFunctionInfoForScriptImpl(
+      isolate, source, script_details, origin_options, nullptr, nullptr,
+      nullptr, compile_hint_callback, compile_hint_callback_data,
+      compile_options, no_cache_reason, natives);
+}
+
+// static
+MaybeHandle<SharedFunctionInfo>
+Compiler::GetSharedFunctionInfoForScriptWithDeserializeTask(
+    Isolate* isolate, Handle<String> source,
+    const Compiler::ScriptDetails& script_details,
+    ScriptOriginOptions origin_options, ScriptData* cached_data,
+    BackgroundDeserializeTask* deserialize_task,
+    ScriptCompiler::CompileOptions compile_options,
+    ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
+  DCHECK_EQ(compile_options, ScriptCompiler::kConsumeCodeCache);
+  DCHECK_NOT_NULL(deserialize_task);
+  return GetSharedFunctionInfoForScriptImpl(
+      isolate, source, script_details, origin_options, nullptr, cached_data,
+      deserialize_task, nullptr, nullptr, compile_options, no_cache_reason,
+      natives);
+}
+
 // static
 MaybeHandle<JSFunction> Compiler::GetWrappedFunction(
     Handle<String> source, Handle<FixedArray> arguments,
@@ -2856,9 +3178,11 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
 
   MaybeHandle<SharedFunctionInfo> maybe_result;
   // Check if compile cache already holds the SFI, if so no need to finalize
-  // the code compiled on the background thread.
+  // the code compiled on the background thread. Scripts streamed with compile
+  // hints bypass the cache, as the cached script would ignore the hints.
   CompilationCache* compilation_cache = isolate->compilation_cache();
-  {
+  const bool use_compilation_cache = !task->has_compile_hints();
+  if (use_compilation_cache) {
     TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                  "V8.StreamingFinalization.CheckCache");
     maybe_result = compilation_cache->LookupScript(
@@ -2950,11 +3274,13 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
           isolate, script, task->flags(), task->compile_state(),
           *task->finalize_unoptimized_compilation_data());
 
-      // Add compiled code to the isolate cache.
-      TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
-                   "V8.StreamingFinalization.AddToCache");
-      compilation_cache->PutScript(source, isolate->native_context(),
-                                   task->language_mode(), result);
+      if (use_compilation_cache) {
+        // Add compiled code to the isolate cache.
+        TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                     "V8.StreamingFinalization.AddToCache");
+        compilation_cache->PutScript(source, isolate->native_context(),
+                                     task->language_mode(), result);
+      }
     }
   }
 
@@ -19,6 +19,7 @@
 #include "src/objects/debug-objects.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/pending-compilation-error-handler.h"
+#include "src/snapshot/code-serializer.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone.h"
 
@@ -28,6 +29,7 @@ namespace internal {
 // Forward declarations.
 class AstRawString;
 class BackgroundCompileTask;
+class BackgroundDeserializeTask;
 class IsCompiledScope;
 class JavaScriptFrame;
 class OptimizedCompilationInfo;
@@ -165,6 +167,31 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
       ScriptCompiler::NoCacheReason no_cache_reason,
       NativesFlag is_natives_code);
 
+  // Create a shared function info object for a String source, compiling the
+  // functions for which |compile_hint_callback| returns true eagerly.
+  static MaybeHandle<SharedFunctionInfo>
+  GetSharedFunctionInfoForScriptWithCompileHints(
+      Isolate* isolate, Handle<String> source,
+      const ScriptDetails& script_details, ScriptOriginOptions origin_options,
+      ScriptCompiler::CompileHintCallback compile_hint_callback,
+      void* compile_hint_callback_data,
+      ScriptCompiler::CompileOptions compile_options,
+      ScriptCompiler::NoCacheReason no_cache_reason,
+      NativesFlag is_natives_code);
+
+  // Create a shared function info object for a String source, consuming a
+  // code cache that |deserialize_task| has already deserialized on a
+  // background thread. |cached_data| is marked as rejected if the cache does
+  // not match the source, in which case the source is compiled instead.
+  static MaybeHandle<SharedFunctionInfo>
+  GetSharedFunctionInfoForScriptWithDeserializeTask(
+      Isolate* isolate, Handle<String> source,
+      const ScriptDetails& script_details, ScriptOriginOptions origin_options,
+      ScriptData* cached_data, BackgroundDeserializeTask* deserialize_task,
+      ScriptCompiler::CompileOptions compile_options,
+      ScriptCompiler::NoCacheReason no_cache_reason,
+      NativesFlag is_natives_code);
+
   // Create a shared function info object for a Script source that has already
   // been parsed and possibly compiled on a background thread while being loaded
   // from a streamed source. On return, the data held by |streaming_data| will
@@ -473,6 +500,12 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
 
   void Run();
 
+  // Compiles the functions of a streamed script for which |callback| returns
+  // true eagerly. Must be called before the task is run.
+  void SetCompileHintCallback(ScriptCompiler::CompileHintCallback callback,
+                              void* data);
+  bool has_compile_hints() const { return has_compile_hints_; }
+
   ParseInfo* info() {
     DCHECK_NOT_NULL(info_);
     return info_.get();
@@ -533,10 +566,35 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
   WorkerThreadRuntimeCallStats* worker_thread_runtime_call_stats_;
   TimedHistogram* timer_;
   LanguageMode language_mode_;
+  bool has_compile_hints_ = false;
 
   DISALLOW_COPY_AND_ASSIGN(BackgroundCompileTask);
 };
 
+// Deserializes a code cache on a background thread, to be finished on the
+// main thread by Compiler::GetSharedFunctionInfoForScriptWithDeserializeTask.
+class V8_EXPORT_PRIVATE BackgroundDeserializeTask {
+ public:
+  BackgroundDeserializeTask(Isolate* isolate,
+                            std::unique_ptr<ScriptCompiler::CachedData> data);
+
+  void Run();
+
+  // Marks |cached_data| as rejected if the deserialized cache is rejected.
+  MaybeHandle<SharedFunctionInfo> Finish(Isolate* isolate,
+                                         ScriptData* cached_data,
+                                         Handle<String> source,
+                                         ScriptOriginOptions origin_options);
+
+ private:
+  Isolate* isolate_for_local_isolate_;
+  std::unique_ptr<ScriptCompiler::CachedData> data_;
+  ScriptData script_data_;
+  CodeSerializer::OffThreadDeserializeData off_thread_data_;
+
+  DISALLOW_COPY_AND_ASSIGN(BackgroundDeserializeTask);
+};
+
 // Contains all data which needs to be transmitted between threads for
 // background parsing and compiling and finalizing it on the main thread.
 struct ScriptStreamingData {
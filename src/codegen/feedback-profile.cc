@@ -0,0 +1,345 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/feedback-profile.h"
+
+#include <map>
+
+#include "src/base/memory.h"
+#include "src/execution/isolate-inl.h"
+#include "src/heap/heap-inl.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/snapshot/code-serializer.h"
+#include "src/snapshot/snapshot-utils.h"
+#include "src/utils/version.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The profile consists of uint32_t-sized header entries followed by the
+// payload:
+// [0] magic number
+// [1] format version
+// [2] version hash
+// [3] source hash
+// [4] payload length
+// [5] payload checksum
+// ...  payload
+//
+// The payload starts with the number of function records, each of which is
+// [start position, end position, profiler ticks, flags, slot count] followed
+// by |slot count| bytes of FeedbackSlotKind.
+constexpr uint32_t kMagicNumber = 0xFEEDB0B0;
+// Bump this whenever the payload layout changes.
+constexpr uint32_t kFormatVersion = 1;
+
+constexpr int kMagicNumberOffset = 0;
+constexpr int kFormatVersionOffset = kMagicNumberOffset + kUInt32Size;
+constexpr int kVersionHashOffset = kFormatVersionOffset + kUInt32Size;
+constexpr int kSourceHashOffset = kVersionHashOffset + kUInt32Size;
+constexpr int kPayloadLengthOffset = kSourceHashOffset + kUInt32Size;
+constexpr int kChecksumOffset = kPayloadLengthOffset + kUInt32Size;
+constexpr int kHeaderSize = kChecksumOffset + kUInt32Size;
+
+constexpr uint32_t kWasOptimizedFlag = 1 << 0;
+
+struct FunctionRecord {
+  int end_position = 0;
+  int profiler_ticks = 0;
+  bool was_optimized = false;
+  std::vector<uint8_t> slot_kinds;
+};
+
+void PutUint32(std::vector<byte>* out, uint32_t value) {
+  size_t offset = out->size();
+  out->resize(offset + kUInt32Size);
+  base::WriteLittleEndianValue<uint32_t>(
+      reinterpret_cast<Address>(out->data() + offset), value);
+}
+
+uint32_t GetHeaderValue(const byte* data, int offset) {
+  return base::ReadLittleEndianValue<uint32_t>(
+      reinterpret_cast<Address>(data + offset));
+}
+
+// Bounds-checked reader over the profile payload. A truncated or otherwise
+// malformed payload makes all subsequent reads fail.
+class PayloadReader {
+ public:
+  explicit PayloadReader(Vector<const byte> payload) : payload_(payload) {}
+
+  bool ReadUint32(uint32_t* value) {
+    if (position_ + kUInt32Size > payload_.size()) return false;
+    *value = base::ReadLittleEndianValue<uint32_t>(
+        reinterpret_cast<Address>(payload_.begin() + position_));
+    position_ += kUInt32Size;
+    return true;
+  }
+
+  bool ReadBytes(size_t count, std::vector<uint8_t>* bytes) {
+    if (count > payload_.size() - position_) return false;
+    bytes->assign(payload_.begin() + position_,
+                  payload_.begin() + position_ + count);
+    position_ += count;
+    return true;
+  }
+
+  bool AtEnd() const { return position_ == payload_.size(); }
+
+ private:
+  Vector<const byte> payload_;
+  size_t position_ = 0;
+};
+
+std::vector<uint8_t> SlotKindsOf(FeedbackMetadata metadata) {
+  std::vector<uint8_t> kinds;
+  for (int i = 0; i < metadata.slot_count();) {
+    FeedbackSlotKind kind = metadata.GetKind(FeedbackSlot(i));
+    kinds.push_back(static_cast<uint8_t>(kind));
+    i += FeedbackMetadata::GetSlotSize(kind);
+  }
+  return kinds;
+}
+
+void TraceRejected(Handle<Script> script, const char* reason) {
+  if (!FLAG_trace_feedback_profile) return;
+  PrintF("[feedback profile for script %d rejected: %s]\n", script->id(),
+         reason);
+}
+
+}  // namespace
+
+// static
+uint32_t FeedbackProfile::SourceHash(Isolate* isolate, Handle<Script> script) {
+  if (!script->source().IsString()) return 0;
+  Handle<String> source(String::cast(script->source()), isolate);
+  uint32_t length_hash =
+      SerializedCodeData::SourceHash(source, script->origin_options());
+  source = String::Flatten(isolate, source);
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  Vector<const byte> bytes;
+  if (content.IsOneByte()) {
+    bytes = content.ToOneByteVector();
+  } else {
+    Vector<const uc16> chars = content.ToUC16Vector();
+    bytes = Vector<const byte>(reinterpret_cast<const byte*>(chars.begin()),
+                               chars.length() * sizeof(uc16));
+  }
+  return static_cast<uint32_t>(
+      base::hash_combine(length_hash, Checksum(bytes)));
+}
+
+// static
+ScriptCompiler::CachedData* FeedbackProfile::Serialize(Isolate* isolate,
+                                                       Handle<Script> script) {
+  HandleScope scope(isolate);
+  uint32_t source_hash = SourceHash(isolate, script);
+
+  // Several closures can share a SharedFunctionInfo; merge their feedback.
+  // Records are ordered by start position to keep the output deterministic.
+  std::map<int, FunctionRecord> records;
+  {
+    HeapObjectIterator iterator(isolate->heap());
+    for (HeapObject obj = iterator.Next(); !obj.is_null();
+         obj = iterator.Next()) {
+      if (!obj.IsFeedbackVector()) continue;
+      FeedbackVector vector = FeedbackVector::cast(obj);
+      SharedFunctionInfo shared = vector.shared_function_info();
+      if (shared.script() != *script) continue;
+      FunctionRecord& record = records[shared.StartPosition()];
+      record.end_position = shared.EndPosition();
+      record.profiler_ticks =
+          std::max(record.profiler_ticks, vector.profiler_ticks());
+      record.was_optimized |= vector.has_optimized_code() ||
+                              vector.optimization_tier() !=
+                                  OptimizationTier::kNone;
+      if (record.slot_kinds.empty()) {
+        record.slot_kinds = SlotKindsOf(vector.metadata());
+      }
+    }
+  }
+
+  std::vector<byte> payload;
+  PutUint32(&payload, static_cast<uint32_t>(records.size()));
+  for (const auto& entry : records) {
+    const FunctionRecord& record = entry.second;
+    PutUint32(&payload, static_cast<uint32_t>(entry.first));
+    PutUint32(&payload, static_cast<uint32_t>(record.end_position));
+    PutUint32(&payload, static_cast<uint32_t>(record.profiler_ticks));
+    PutUint32(&payload, record.was_optimized ? kWasOptimizedFlag : 0);
+    PutUint32(&payload, static_cast<uint32_t>(record.slot_kinds.size()));
+    payload.insert(payload.end(), record.slot_kinds.begin(),
+                   record.slot_kinds.end());
+  }
+
+  int size = kHeaderSize + static_cast<int>(payload.size());
+  byte* data = NewArray<byte>(size);
+  Address header = reinterpret_cast<Address>(data);
+  base::WriteLittleEndianValue<uint32_t>(header + kMagicNumberOffset,
+                                         kMagicNumber);
+  base::WriteLittleEndianValue<uint32_t>(header + kFormatVersionOffset,
+                                         kFormatVersion);
+  base::WriteLittleEndianValue<uint32_t>(header + kVersionHashOffset,
+                                         Version::Hash());
+  base::WriteLittleEndianValue<uint32_t>(header + kSourceHashOffset,
+                                         source_hash);
+  base::WriteLittleEndianValue<uint32_t>(
+      header + kPayloadLengthOffset, static_cast<uint32_t>(payload.size()));
+  CopyBytes(data + kHeaderSize, payload.data(), payload.size());
+  base::WriteLittleEndianValue<uint32_t>(
+      header + kChecksumOffset,
+      Checksum(Vector<const byte>(data + kHeaderSize, payload.size())));
+
+  if (FLAG_trace_feedback_profile) {
+    PrintF("[feedback profile for script %d: %zu functions, %d bytes]\n",
+           script->id(), records.size(), size);
+  }
+  return new ScriptCompiler::CachedData(
+      data, size, ScriptCompiler::CachedData::BufferOwned);
+}
+
+// static
+bool FeedbackProfile::Preload(Isolate* isolate, Handle<Script> script,
+                              const byte* data, int length) {
+  if (length < kHeaderSize) {
+    TraceRejected(script, "invalid header");
+    return false;
+  }
+  if (GetHeaderValue(data, kMagicNumberOffset) != kMagicNumber) {
+    TraceRejected(script, "magic number mismatch");
+    return false;
+  }
+  if (GetHeaderValue(data, kFormatVersionOffset) != kFormatVersion ||
+      GetHeaderValue(data, kVersionHashOffset) != Version::Hash()) {
+    TraceRejected(script, "version mismatch");
+    return false;
+  }
+  if (GetHeaderValue(data, kSourceHashOffset) != SourceHash(isolate, script)) {
+    TraceRejected(script, "source mismatch");
+    return false;
+  }
+  uint32_t payload_length = GetHeaderValue(data, kPayloadLengthOffset);
+  if (payload_length != static_cast<uint32_t>(length - kHeaderSize)) {
+    TraceRejected(script, "length mismatch");
+    return false;
+  }
+  Vector<const byte> payload(data + kHeaderSize, payload_length);
+  if (Checksum(payload) != GetHeaderValue(data, kChecksumOffset)) {
+    TraceRejected(script, "checksum mismatch");
+    return false;
+  }
+
+  // Parse everything before registering anything, so that a malformed
+  // profile has no effect at all.
+  PayloadReader reader(payload);
+  uint32_t count;
+  if (!reader.ReadUint32(&count)) {
+    TraceRejected(script, "malformed payload");
+    return false;
+  }
+  std::vector<std::pair<int, FeedbackProfileTable::Entry>> entries;
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t start_position, end_position, ticks, flags, slot_count;
+    FeedbackProfileTable::Entry entry;
+    if (!reader.ReadUint32(&start_position) ||
+        !reader.ReadUint32(&end_position) || !reader.ReadUint32(&ticks) ||
+        !reader.ReadUint32(&flags) || !reader.ReadUint32(&slot_count) ||
+        !reader.ReadBytes(slot_count, &entry.slot_kinds) ||
+        start_position > static_cast<uint32_t>(Smi::kMaxValue) ||
+        end_position > static_cast<uint32_t>(Smi::kMaxValue) ||
+        ticks > static_cast<uint32_t>(Smi::kMaxValue)) {
+      TraceRejected(script, "malformed payload");
+      return false;
+    }
+    entry.end_position = static_cast<int>(end_position);
+    entry.profiler_ticks = static_cast<int>(ticks);
+    entry.was_optimized = (flags & kWasOptimizedFlag) != 0;
+    entries.emplace_back(static_cast<int>(start_position), std::move(entry));
+  }
+  if (!reader.AtEnd()) {
+    TraceRejected(script, "malformed payload");
+    return false;
+  }
+
+  if (entries.size() > FeedbackProfileTable::kMaxEntries) {
+    TraceRejected(script, "too many functions");
+    return false;
+  }
+  FeedbackProfileTable* table = isolate->EnsureFeedbackProfileTable();
+  if (table->size() + entries.size() > FeedbackProfileTable::kMaxEntries) {
+    if (FLAG_trace_feedback_profile) {
+      PrintF("[feedback profile table full, evicting %zu entries]\n",
+             table->size());
+    }
+    table->Clear();
+  }
+  for (auto& entry : entries) {
+    table->Add(script->id(), entry.first, std::move(entry.second));
+  }
+  if (FLAG_trace_feedback_profile) {
+    PrintF("[feedback profile for script %d preloaded: %zu functions]\n",
+           script->id(), entries.size());
+  }
+  return true;
+}
+
+// static
+void FeedbackProfile::ApplyTo(Isolate* isolate, Handle<FeedbackVector> vector) {
+  FeedbackProfileTable* table = isolate->feedback_profile_table();
+  if (table == nullptr || table->empty()) return;
+  SharedFunctionInfo shared = vector->shared_function_info();
+  if (!shared.script().IsScript()) return;
+  Script script = Script::cast(shared.script());
+
+  FeedbackProfileTable::Entry entry;
+  if (!table->Take(script.id(), shared.StartPosition(), &entry)) return;
+
+  // The source hash guarantees that the script is unchanged, but the
+  // feedback layout also depends on the bytecode generator. Only use entries
+  // whose shape still matches.
+  if (entry.end_position != shared.EndPosition() ||
+      entry.slot_kinds != SlotKindsOf(vector->metadata())) {
+    if (FLAG_trace_feedback_profile) {
+      PrintF("[feedback profile entry for ");
+      shared.ShortPrint();
+      PrintF(" is stale]\n");
+    }
+    return;
+  }
+  if (!entry.was_optimized && entry.profiler_ticks == 0) return;
+
+  // Seeding the profiler ticks lets the RuntimeProfiler consider the function
+  // hot as soon as it has gathered one interrupt budget of fresh feedback.
+  // The invocation count is deliberately not seeded, as TurboFan relates it
+  // to the (fresh) call counts when computing call frequencies.
+  vector->set_profiler_ticks(entry.profiler_ticks);
+  if (FLAG_trace_feedback_profile) {
+    PrintF("[feedback profile seeded ");
+    shared.ShortPrint();
+    PrintF(" with %d ticks]\n", entry.profiler_ticks);
+  }
+}
+
+void FeedbackProfileTable::Add(int script_id, int start_position,
+                               Entry entry) {
+  DCHECK_LT(entries_.size(), kMaxEntries);
+  entries_[std::make_pair(script_id, start_position)] = std::move(entry);
+}
+
+bool FeedbackProfileTable::Take(int script_id, int start_position,
+                                Entry* entry) {
+  auto it = entries_.find(std::make_pair(script_id, start_position));
+  if (it == entries_.end()) return false;
+  *entry = std::move(it->second);
+  entries_.erase(it);
+  return true;
+}
+
+}  // namespace internal
+}  // namespace v8
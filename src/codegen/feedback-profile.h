@@ -0,0 +1,100 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_FEEDBACK_PROFILE_H_
+#define V8_CODEGEN_FEEDBACK_PROFILE_H_
+
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8.h"
+#include "src/base/functional.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class FeedbackVector;
+class Script;
+
+// A feedback profile is a versioned record of how hot the functions of a
+// single script got. It can be produced in one process and preloaded into an
+// isolate of a later process that compiles the same source, so that hot
+// functions tier up after their first profiler tick instead of re-learning
+// their hotness from scratch.
+//
+// The profile carries no type feedback: heap objects referenced from feedback
+// (maps, call targets, allocation sites) do not exist in a fresh isolate, so
+// preloaded functions still collect all of their feedback afresh. Only the
+// structural shape of each feedback vector (its slot kinds) is recorded along
+// with the function's hotness, to validate a profile entry against the
+// function it is applied to; entries that no longer match are dropped
+// silently, so stale profiles degrade to the default behavior.
+class FeedbackProfile {
+ public:
+  // Produces a profile for all functions of |script| that currently have a
+  // feedback vector. The returned CachedData is owned by the caller.
+  V8_EXPORT_PRIVATE static ScriptCompiler::CachedData* Serialize(
+      Isolate* isolate, Handle<Script> script);
+
+  // Validates |data| against |script| and, if it was produced by the same
+  // V8 version for the same source, registers its entries with the isolate.
+  // Returns false if the profile was rejected.
+  V8_EXPORT_PRIVATE static bool Preload(Isolate* isolate,
+                                        Handle<Script> script,
+                                        const byte* data, int length);
+
+  // Called for every newly allocated feedback vector; seeds the profiler
+  // ticks of the vector with the preloaded hotness of its function, if any.
+  static void ApplyTo(Isolate* isolate, Handle<FeedbackVector> vector);
+
+  static uint32_t SourceHash(Isolate* isolate, Handle<Script> script);
+};
+
+// Per-isolate table of preloaded profile entries, keyed by script id and
+// function start position. Entries are consumed when the first feedback
+// vector for the function is allocated. Functions that never run would keep
+// their entries forever, so the table is bounded: a profile that doesn't fit
+// evicts all entries of earlier profiles.
+class FeedbackProfileTable {
+ public:
+  static constexpr size_t kMaxEntries = 64 * KB;
+
+  struct Entry {
+    int end_position;
+    int profiler_ticks;
+    bool was_optimized;
+    std::vector<uint8_t> slot_kinds;
+  };
+
+  FeedbackProfileTable() = default;
+  FeedbackProfileTable(const FeedbackProfileTable&) = delete;
+  FeedbackProfileTable& operator=(const FeedbackProfileTable&) = delete;
+
+  void Add(int script_id, int start_position, Entry entry);
+  // Removes and returns the entry for the given function. Returns false if
+  // there is none.
+  bool Take(int script_id, int start_position, Entry* entry);
+
+  void Clear() { entries_.clear(); }
+
+  bool empty() const { return entries_.empty(); }
+  size_t size() const { return entries_.size(); }
+
+ private:
+  using Key = std::pair<int, int>;
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      return base::hash_combine(key.first, key.second);
+    }
+  };
+
+  std::unordered_map<Key, Entry, KeyHash> entries_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_FEEDBACK_PROFILE_H_
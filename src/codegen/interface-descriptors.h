@@ -80,6 +80,8 @@ namespace internal {
   V(LoadWithVector)                      \
   V(LoadWithReceiverAndVector)           \
   V(NoContext)                           \
+  V(ProxyGetPropertyStackParameter)      \
+  V(ProxySetPropertyStackParameter)      \
   V(RecordWrite)                         \
   V(ResumeGenerator)                     \
   V(RunMicrotasks)                       \
@@ -948,6 +950,31 @@ class GetIteratorStackParameterDescriptor final
                      CallInterfaceDescriptor)
 };
 
+class ProxyGetPropertyStackParameterDescriptor final
+    : public CallInterfaceDescriptor {
+ public:
+  DEFINE_PARAMETERS(kProxy, kTarget, kName, kResult)
+  DEFINE_PARAMETER_TYPES(MachineType::TaggedPointer(),  // kProxy
+                         MachineType::TaggedPointer(),  // kTarget
+                         MachineType::TaggedPointer(),  // kName
+                         MachineType::AnyTagged())      // kResult
+  DECLARE_DESCRIPTOR(ProxyGetPropertyStackParameterDescriptor,
+                     CallInterfaceDescriptor)
+};
+
+class ProxySetPropertyStackParameterDescriptor final
+    : public CallInterfaceDescriptor {
+ public:
+  DEFINE_PARAMETERS(kProxy, kTarget, kName, kValue, kResult)
+  DEFINE_PARAMETER_TYPES(MachineType::TaggedPointer(),  // kProxy
+                         MachineType::TaggedPointer(),  // kTarget
+                         MachineType::TaggedPointer(),  // kName
+                         MachineType::AnyTagged(),      // kValue
+                         MachineType::AnyTagged())      // kResult
+  DECLARE_DESCRIPTOR(ProxySetPropertyStackParameterDescriptor,
+                     CallInterfaceDescriptor)
+};
+
 class GetPropertyDescriptor final : public CallInterfaceDescriptor {
  public:
   DEFINE_PARAMETERS(kObject, kKey)
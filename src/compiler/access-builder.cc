@@ -792,6 +792,16 @@ FieldAccess AccessBuilder::ForJSGlobalProxyNativeContext() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForJSProxyHandler() {
+  FieldAccess access = {
+      kTaggedBase,         JSProxy::kHandlerOffset,
+      Handle<Name>(),      MaybeHandle<Map>(),
+      Type::Any(),         MachineType::TaggedPointer(),
+      kPointerWriteBarrier};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForJSArrayIteratorIteratedObject() {
   FieldAccess access = {
@@ -254,6 +254,9 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to JSGlobalProxy::native_context() field.
   static FieldAccess ForJSGlobalProxyNativeContext();
 
+  // Provides access to JSProxy::handler() field.
+  static FieldAccess ForJSProxyHandler();
+
   // Provides access to JSArrayIterator::iterated_object() field.
   static FieldAccess ForJSArrayIteratorIteratedObject();
 
@@ -116,6 +116,14 @@ void UpdateInLiveness(Bytecode bytecode, BytecodeLivenessState* in_liveness,
     in_liveness->MarkRegisterLive(accessor.GetRegisterOperand(0).index());
     return;
   }
+  // Short Star bytecodes write to an implicit register.
+  if (Bytecodes::IsShortStar(bytecode)) {
+    in_liveness->MarkRegisterDead(
+        interpreter::Register::FromShortStar(bytecode).index());
+    DCHECK(Bytecodes::ReadsAccumulator(bytecode));
+    in_liveness->MarkAccumulatorLive();
+    return;
+  }
 
   if (Bytecodes::WritesAccumulator(bytecode)) {
     in_liveness->MarkAccumulatorDead();
@@ -283,6 +291,12 @@ void UpdateAssignments(Bytecode bytecode, BytecodeLoopAssignments* assignments,
   int num_operands = Bytecodes::NumberOfOperands(bytecode);
   const OperandType* operand_types = Bytecodes::GetOperandTypes(bytecode);
 
+  // Short Star bytecodes write to an implicit register.
+  if (Bytecodes::IsShortStar(bytecode)) {
+    assignments->Add(interpreter::Register::FromShortStar(bytecode));
+    return;
+  }
+
   for (int i = 0; i < num_operands; ++i) {
     switch (operand_types[i]) {
       case OperandType::kRegOut: {
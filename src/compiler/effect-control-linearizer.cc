@@ -113,7 +113,9 @@ class EffectControlLinearizer {
   Node* LowerCheckedTaggedToFloat64(Node* node, Node* frame_state);
   Node* LowerCheckedTaggedToTaggedSigned(Node* node, Node* frame_state);
   Node* LowerCheckedTaggedToTaggedPointer(Node* node, Node* frame_state);
+  Node* LowerBigIntAsIntN(Node* node, Node* frame_state);
   Node* LowerBigIntAsUintN(Node* node, Node* frame_state);
+  Node* LowerChangeInt64ToBigInt(Node* node);
   Node* LowerChangeUint64ToBigInt(Node* node);
   Node* LowerTruncateBigIntToUint64(Node* node);
   Node* LowerChangeTaggedToFloat64(Node* node);
@@ -176,6 +178,8 @@ class EffectControlLinearizer {
   Node* LowerStringLessThanOrEqual(Node* node);
   Node* LowerBigIntAdd(Node* node, Node* frame_state);
   Node* LowerBigIntSubtract(Node* node, Node* frame_state);
+  Node* LowerBigIntBinopViaRuntime(Node* node, Operation op,
+                                   Node* frame_state);
   Node* LowerBigIntNegate(Node* node);
   Node* LowerCheckFloat64Hole(Node* node, Node* frame_state);
   Node* LowerCheckNotTaggedHole(Node* node, Node* frame_state);
@@ -242,10 +246,14 @@ class EffectControlLinearizer {
                       Node* frame_state);
   Node* BuildUint32Mod(Node* lhs, Node* rhs);
   Node* ComputeUnseededHash(Node* value);
+  Node* BuildFindOrderedHashMapEntry(Node* table, Node* key, Node* hash,
+                                     GraphAssemblerLabel<0>* if_bailout);
   Node* LowerStringComparison(Callable const& callable, Node* node);
   Node* IsElementsKindGreaterThan(Node* kind, ElementsKind reference_kind);
 
   Node* BuildTypedArrayDataPointer(Node* base, Node* external);
+  Node* AdaptFastCallArgument(Node* value, CTypeInfo arg_type,
+                              GraphAssemblerLabel<0>* if_error);
 
   template <typename... Args>
   Node* CallBuiltin(Builtins::Name builtin, Operator::Properties properties,
@@ -1062,9 +1070,15 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kCheckedTaggedToTaggedPointer:
       result = LowerCheckedTaggedToTaggedPointer(node, frame_state);
       break;
+    case IrOpcode::kBigIntAsIntN:
+      result = LowerBigIntAsIntN(node, frame_state);
+      break;
     case IrOpcode::kBigIntAsUintN:
       result = LowerBigIntAsUintN(node, frame_state);
       break;
+    case IrOpcode::kChangeInt64ToBigInt:
+      result = LowerChangeInt64ToBigInt(node);
+      break;
     case IrOpcode::kChangeUint64ToBigInt:
       result = LowerChangeUint64ToBigInt(node);
       break;
@@ -1224,6 +1238,22 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kBigIntSubtract:
       result = LowerBigIntSubtract(node, frame_state);
       break;
+    case IrOpcode::kBigIntMultiply:
+      result = LowerBigIntBinopViaRuntime(node, Operation::kMultiply,
+                                          frame_state);
+      break;
+    case IrOpcode::kBigIntBitwiseAnd:
+      result = LowerBigIntBinopViaRuntime(node, Operation::kBitwiseAnd,
+                                          frame_state);
+      break;
+    case IrOpcode::kBigIntBitwiseOr:
+      result = LowerBigIntBinopViaRuntime(node, Operation::kBitwiseOr,
+                                          frame_state);
+      break;
+    case IrOpcode::kBigIntBitwiseXor:
+      result = LowerBigIntBinopViaRuntime(node, Operation::kBitwiseXor,
+                                          frame_state);
+      break;
     case IrOpcode::kBigIntNegate:
       result = LowerBigIntNegate(node);
       break;
@@ -2914,6 +2944,25 @@ Node* EffectControlLinearizer::LowerCheckBigInt(Node* node, Node* frame_state) {
   return value;
 }
 
+Node* EffectControlLinearizer::LowerBigIntAsIntN(Node* node,
+                                                 Node* frame_state) {
+  DCHECK(machine()->Is64());
+
+  const int bits = OpParameter<int>(node->op());
+  DCHECK(0 <= bits && bits <= 64);
+
+  if (bits == 64) {
+    // Reduce to nop.
+    return node->InputAt(0);
+  } else if (bits == 0) {
+    return __ Int64Constant(0);
+  } else {
+    // Sign-extend from the most significant of the remaining {bits}.
+    Node* shift = __ Int64Constant(64 - bits);
+    return __ WordSar(__ WordShl(node->InputAt(0), shift), shift);
+  }
+}
+
 Node* EffectControlLinearizer::LowerBigIntAsUintN(Node* node,
                                                   Node* frame_state) {
   DCHECK(machine()->Is64());
@@ -2930,6 +2979,64 @@ Node* EffectControlLinearizer::LowerBigIntAsUintN(Node* node,
   }
 }
 
+Node* EffectControlLinearizer::LowerChangeInt64ToBigInt(Node* node) {
+  DCHECK(machine()->Is64());
+
+  Node* value = node->InputAt(0);
+  Node* map = __ HeapConstant(factory()->bigint_map());
+  // BigInts with value 0 must be of size 0 (canonical form).
+  auto if_zerodigits = __ MakeLabel();
+  auto if_onedigit = __ MakeLabel();
+  auto done = __ MakeLabel(MachineRepresentation::kTagged);
+
+  __ GotoIf(__ Word64Equal(value, __ IntPtrConstant(0)), &if_zerodigits);
+  __ Goto(&if_onedigit);
+
+  __ Bind(&if_onedigit);
+  {
+    // BigInts are stored as sign and magnitude. Negating kMinInt64 yields
+    // the correct magnitude when interpreted as an unsigned digit.
+    STATIC_ASSERT(BigInt::SignBits::kShift == 0);
+    Node* sign_mask = __ WordSar(value, __ Int64Constant(63));
+    Node* magnitude = __ Int64Sub(__ WordXor(value, sign_mask), sign_mask);
+    Node* sign = __ TruncateInt64ToInt32(
+        __ WordShr(value, __ Int64Constant(63)));
+    Node* result = __ Allocate(AllocationType::kYoung,
+                               __ IntPtrConstant(BigInt::SizeFor(1)));
+    const auto bitfield = BigInt::LengthBits::update(0, 1);
+    __ StoreField(AccessBuilder::ForMap(), result, map);
+    __ StoreField(AccessBuilder::ForBigIntBitfield(), result,
+                  __ Word32Or(__ Int32Constant(bitfield), sign));
+    // BigInts have no padding on 64 bit architectures with pointer compression.
+    if (BigInt::HasOptionalPadding()) {
+      __ StoreField(AccessBuilder::ForBigIntOptionalPadding(), result,
+                    __ IntPtrConstant(0));
+    }
+    __ StoreField(AccessBuilder::ForBigIntLeastSignificantDigit64(), result,
+                  magnitude);
+    __ Goto(&done, result);
+  }
+
+  __ Bind(&if_zerodigits);
+  {
+    Node* result = __ Allocate(AllocationType::kYoung,
+                               __ IntPtrConstant(BigInt::SizeFor(0)));
+    const auto bitfield = BigInt::LengthBits::update(0, 0);
+    __ StoreField(AccessBuilder::ForMap(), result, map);
+    __ StoreField(AccessBuilder::ForBigIntBitfield(), result,
+                  __ IntPtrConstant(bitfield));
+    // BigInts have no padding on 64 bit architectures with pointer compression.
+    if (BigInt::HasOptionalPadding()) {
+      __ StoreField(AccessBuilder::ForBigIntOptionalPadding(), result,
+                    __ IntPtrConstant(0));
+    }
+    __ Goto(&done, result);
+  }
+
+  __ Bind(&done);
+  return done.PhiAt(0);
+}
+
 Node* EffectControlLinearizer::LowerChangeUint64ToBigInt(Node* node) {
   DCHECK(machine()->Is64());
 
@@ -4530,8 +4637,9 @@ Node* EffectControlLinearizer::LowerBigIntAdd(Node* node, Node* frame_state) {
                         rhs, __ NoContextConstant());
 
   // Check for exception sentinel: Smi is returned to signal BigIntTooBig.
-  __ DeoptimizeIf(DeoptimizeReason::kBigIntTooBig, FeedbackSource{},
-                  ObjectIsSmi(value), frame_state);
+  __ DeoptimizeIf(DeoptimizeReason::kBigIntTooBig,
+                  CheckParametersOf(node->op()).feedback(), ObjectIsSmi(value),
+                  frame_state);
 
   return value;
 }
@@ -4551,8 +4659,30 @@ Node* EffectControlLinearizer::LowerBigIntSubtract(Node* node,
                         rhs, __ NoContextConstant());
 
   // Check for exception sentinel: Smi is returned to signal BigIntTooBig.
-  __ DeoptimizeIf(DeoptimizeReason::kBigIntTooBig, FeedbackSource{},
-                  ObjectIsSmi(value), frame_state);
+  __ DeoptimizeIf(DeoptimizeReason::kBigIntTooBig,
+                  CheckParametersOf(node->op()).feedback(), ObjectIsSmi(value),
+                  frame_state);
+
+  return value;
+}
+
+Node* EffectControlLinearizer::LowerBigIntBinopViaRuntime(Node* node,
+                                                          Operation op,
+                                                          Node* frame_state) {
+  Operator::Properties properties = Operator::kNoDeopt | Operator::kNoThrow;
+  Runtime::FunctionId id = Runtime::kBigIntBinaryOpNoThrow;
+  auto call_descriptor = Linkage::GetRuntimeCallDescriptor(
+      graph()->zone(), id, 3, properties, CallDescriptor::kNoFlags);
+  Node* value =
+      __ Call(call_descriptor, __ CEntryStubConstant(1), node->InputAt(0),
+              node->InputAt(1), __ SmiConstant(static_cast<int>(op)),
+              __ ExternalConstant(ExternalReference::Create(id)),
+              __ Int32Constant(3), __ NoContextConstant());
+
+  // Check for exception sentinel: Smi is returned to signal BigIntTooBig.
+  __ DeoptimizeIf(DeoptimizeReason::kBigIntTooBig,
+                  CheckParametersOf(node->op()).feedback(), ObjectIsSmi(value),
+                  frame_state);
 
   return value;
 }
@@ -5039,7 +5169,155 @@ static MachineType MachineTypeFor(CTypeInfo::Type type) {
       return MachineType::Float64();
     case CTypeInfo::Type::kV8Value:
       return MachineType::AnyTagged();
+    case CTypeInfo::Type::kUint8:
+      return MachineType::Uint8();
+  }
+}
+
+static MachineType MachineTypeFor(CTypeInfo arg_type) {
+  // Sequences are passed as a pointer to a (pointer, length) view.
+  if (arg_type.GetSequenceType() != CTypeInfo::SequenceType::kScalar) {
+    return MachineType::Pointer();
   }
+  return MachineTypeFor(arg_type.GetType());
+}
+
+namespace {
+
+ElementsKind TypedArrayElementsKindFor(CTypeInfo::Type type) {
+  switch (type) {
+    case CTypeInfo::Type::kUint8:
+      return UINT8_ELEMENTS;
+    case CTypeInfo::Type::kInt32:
+      return INT32_ELEMENTS;
+    case CTypeInfo::Type::kUint32:
+      return UINT32_ELEMENTS;
+    case CTypeInfo::Type::kInt64:
+      return BIGINT64_ELEMENTS;
+    case CTypeInfo::Type::kUint64:
+      return BIGUINT64_ELEMENTS;
+    case CTypeInfo::Type::kFloat32:
+      return FLOAT32_ELEMENTS;
+    case CTypeInfo::Type::kFloat64:
+      return FLOAT64_ELEMENTS;
+    case CTypeInfo::Type::kVoid:
+    case CTypeInfo::Type::kBool:
+    case CTypeInfo::Type::kV8Value:
+      break;
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
+
+// Checks that {value} has the shape required by {arg_type} and returns the
+// value to pass to the C function. Typed arrays and sequential one-byte
+// strings are unpacked into a (pointer, length) view in a fresh stack slot,
+// whose address is passed instead. Jumps to {if_error} if {value} does not
+// have the expected shape, so that the slow callback handles the call.
+Node* EffectControlLinearizer::AdaptFastCallArgument(
+    Node* value, CTypeInfo arg_type, GraphAssemblerLabel<0>* if_error) {
+  switch (arg_type.GetSequenceType()) {
+    case CTypeInfo::SequenceType::kScalar:
+      if (arg_type.GetType() == CTypeInfo::Type::kFloat32) {
+        return __ TruncateFloat64ToFloat32(value);
+      }
+      return value;
+
+    case CTypeInfo::SequenceType::kIsTypedArray: {
+      __ GotoIf(ObjectIsSmi(value), if_error);
+      Node* value_map = __ LoadField(AccessBuilder::ForMap(), value);
+      Node* value_instance_type =
+          __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+      __ GotoIfNot(__ Word32Equal(value_instance_type,
+                                  __ Int32Constant(JS_TYPED_ARRAY_TYPE)),
+                   if_error);
+
+      // The element type has to match exactly; Uint8ClampedArray shares the
+      // representation of Uint8Array.
+      Node* bit_field2 =
+          __ LoadField(AccessBuilder::ForMapBitField2(), value_map);
+      Node* elements_kind = __ Word32Shr(
+          __ Word32And(bit_field2,
+                       __ Int32Constant(Map::Bits2::ElementsKindBits::kMask)),
+          __ Int32Constant(Map::Bits2::ElementsKindBits::kShift));
+      ElementsKind expected_kind =
+          TypedArrayElementsKindFor(arg_type.GetType());
+      Node* check_kind =
+          __ Word32Equal(elements_kind, __ Int32Constant(expected_kind));
+      if (expected_kind == UINT8_ELEMENTS) {
+        check_kind = __ Word32Or(
+            check_kind,
+            __ Word32Equal(elements_kind,
+                           __ Int32Constant(UINT8_CLAMPED_ELEMENTS)));
+      }
+      __ GotoIfNot(check_kind, if_error);
+
+      Node* buffer =
+          __ LoadField(AccessBuilder::ForJSArrayBufferViewBuffer(), value);
+      Node* buffer_bit_field =
+          __ LoadField(AccessBuilder::ForJSArrayBufferBitField(), buffer);
+      __ GotoIfNot(
+          __ Word32Equal(
+              __ Word32And(
+                  buffer_bit_field,
+                  __ Int32Constant(JSArrayBuffer::WasDetachedBit::kMask)),
+              __ Int32Constant(0)),
+          if_error);
+
+      Node* data_pointer = BuildTypedArrayDataPointer(
+          __ LoadField(AccessBuilder::ForJSTypedArrayBasePointer(), value),
+          __ LoadField(AccessBuilder::ForJSTypedArrayExternalPointer(), value));
+      Node* length =
+          __ LoadField(AccessBuilder::ForJSTypedArrayLength(), value);
+
+      // Layout of v8::FastApiTypedArray<T>.
+      STATIC_ASSERT(sizeof(v8::FastApiTypedArray<uint8_t>) ==
+                    2 * kSystemPointerSize);
+      Node* stack_slot =
+          __ StackSlot(2 * kSystemPointerSize, kSystemPointerSize);
+      __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                                   kNoWriteBarrier),
+               stack_slot, 0, data_pointer);
+      __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                                   kNoWriteBarrier),
+               stack_slot, kSystemPointerSize, length);
+      return stack_slot;
+    }
+
+    case CTypeInfo::SequenceType::kIsOneByteString: {
+      __ GotoIf(ObjectIsSmi(value), if_error);
+      Node* value_map = __ LoadField(AccessBuilder::ForMap(), value);
+      Node* value_instance_type =
+          __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+      __ GotoIfNot(
+          __ Word32Equal(
+              __ Word32And(value_instance_type,
+                           __ Int32Constant(kIsNotStringMask |
+                                            kStringRepresentationMask |
+                                            kStringEncodingMask)),
+              __ Int32Constant(kStringTag | kSeqStringTag | kOneByteStringTag)),
+          if_error);
+
+      Node* data_pointer = __ IntAdd(
+          __ BitcastTaggedToWord(value),
+          __ IntPtrConstant(SeqOneByteString::kHeaderSize - kHeapObjectTag));
+      Node* length = __ LoadField(AccessBuilder::ForStringLength(), value);
+
+      // Layout of v8::FastOneByteString.
+      STATIC_ASSERT(sizeof(v8::FastOneByteString) == 2 * kSystemPointerSize);
+      Node* stack_slot =
+          __ StackSlot(2 * kSystemPointerSize, kSystemPointerSize);
+      __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                                   kNoWriteBarrier),
+               stack_slot, 0, data_pointer);
+      __ Store(StoreRepresentation(MachineRepresentation::kWord32,
+                                   kNoWriteBarrier),
+               stack_slot, kSystemPointerSize, length);
+      return stack_slot;
+    }
+  }
+  UNREACHABLE();
 }
 
 Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
@@ -5065,6 +5343,20 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
     fast_api_call_stack_slot_ = __ StackSlot(kSize, kAlign);
   }
 
+  // Taken if an argument does not have the shape expected by the C
+  // function, or if the C function requests the fallback.
+  auto if_error = __ MakeDeferredLabel();
+
+  Node** const inputs = graph()->zone()->NewArray<Node*>(
+      c_arg_count + FastApiCallNode::kFastCallExtraInputCount);
+  inputs[0] = NodeProperties::GetValueInput(node, 0);  // the target
+  for (int i = FastApiCallNode::kFastTargetInputCount;
+       i < c_arg_count + FastApiCallNode::kFastTargetInputCount; ++i) {
+    inputs[i] =
+        AdaptFastCallArgument(NodeProperties::GetValueInput(node, i),
+                              c_signature->ArgumentInfo(i - 1), &if_error);
+  }
+
   // Generate the store to `fast_api_call_stack_slot_`.
   __ Store(StoreRepresentation(MachineRepresentation::kWord32, kNoWriteBarrier),
            fast_api_call_stack_slot_, 0, jsgraph()->ZeroConstant());
@@ -5074,8 +5366,7 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
   MachineType return_type = MachineTypeFor(c_signature->ReturnInfo().GetType());
   builder.AddReturn(return_type);
   for (int i = 0; i < c_arg_count; ++i) {
-    MachineType machine_type =
-        MachineTypeFor(c_signature->ArgumentInfo(i).GetType());
+    MachineType machine_type = MachineTypeFor(c_signature->ArgumentInfo(i));
     builder.AddParam(machine_type);
   }
   builder.AddParam(MachineType::Pointer());  // fast_api_call_stack_slot_
@@ -5085,19 +5376,6 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
 
   call_descriptor->SetCFunctionInfo(c_signature);
 
-  Node** const inputs = graph()->zone()->NewArray<Node*>(
-      c_arg_count + FastApiCallNode::kFastCallExtraInputCount);
-  inputs[0] = NodeProperties::GetValueInput(node, 0);  // the target
-  for (int i = FastApiCallNode::kFastTargetInputCount;
-       i < c_arg_count + FastApiCallNode::kFastTargetInputCount; ++i) {
-    if (c_signature->ArgumentInfo(i - 1).GetType() ==
-        CTypeInfo::Type::kFloat32) {
-      inputs[i] =
-          __ TruncateFloat64ToFloat32(NodeProperties::GetValueInput(node, i));
-    } else {
-      inputs[i] = NodeProperties::GetValueInput(node, i);
-    }
-  }
   inputs[c_arg_count + 1] = fast_api_call_stack_slot_;
   inputs[c_arg_count + 2] = __ effect();
   inputs[c_arg_count + 3] = __ control();
@@ -5112,7 +5390,6 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
       TNode<Boolean>::UncheckedCast(__ Word32Equal(load, __ Int32Constant(0)));
   // Hint to true.
   auto if_success = __ MakeLabel();
-  auto if_error = __ MakeDeferredLabel();
   auto merge = __ MakeLabel(MachineRepresentation::kTagged);
   __ Branch(cond, &if_success, &if_error);
 
@@ -6295,6 +6572,51 @@ Node* EffectControlLinearizer::LowerFindOrderedHashMapEntry(Node* node) {
   Node* table = NodeProperties::GetValueInput(node, 0);
   Node* key = NodeProperties::GetValueInput(node, 1);
 
+  // Smi and internalized string keys are probed inline; all other keys (and
+  // tables that contain non-internalized string keys along the probed chain)
+  // go through the FindOrderedHashMapEntry builtin.
+  auto if_smi = __ MakeLabel();
+  auto if_not_smi = __ MakeLabel();
+  auto call_builtin = __ MakeDeferredLabel();
+  auto done = __ MakeLabel(MachineRepresentation::kTaggedSigned);
+
+  __ Branch(ObjectIsSmi(key), &if_smi, &if_not_smi);
+
+  __ Bind(&if_smi);
+  {
+    Node* int32_key = ChangeSmiToInt32(key);
+    Node* hash = ChangeUint32ToUintPtr(ComputeUnseededHash(int32_key));
+    Node* entry = BuildFindOrderedHashMapEntry(table, int32_key, hash, nullptr);
+    __ Goto(&done, ChangeIntPtrToSmi(entry));
+  }
+
+  __ Bind(&if_not_smi);
+  {
+    Node* key_map = __ LoadField(AccessBuilder::ForMap(), key);
+    Node* key_instance_type =
+        __ LoadField(AccessBuilder::ForMapInstanceType(), key_map);
+    __ GotoIfNot(
+        __ Word32Equal(
+            __ Word32And(key_instance_type,
+                         __ Int32Constant(kIsNotStringMask |
+                                          kIsNotInternalizedMask)),
+            __ Int32Constant(kStringTag | kInternalizedTag)),
+        &call_builtin);
+    Node* hash_field = __ LoadField(AccessBuilder::ForNameHashField(), key);
+    __ GotoIfNot(
+        __ Word32Equal(
+            __ Word32And(hash_field,
+                         __ Int32Constant(Name::kHashNotComputedMask)),
+            __ Int32Constant(0)),
+        &call_builtin);
+    Node* hash = ChangeUint32ToUintPtr(
+        __ Word32Shr(hash_field, __ Int32Constant(Name::kHashShift)));
+    Node* entry =
+        BuildFindOrderedHashMapEntry(table, key, hash, &call_builtin);
+    __ Goto(&done, ChangeIntPtrToSmi(entry));
+  }
+
+  __ Bind(&call_builtin);
   {
     Callable const callable =
         Builtins::CallableFor(isolate(), Builtins::kFindOrderedHashMapEntry);
@@ -6303,9 +6625,12 @@ Node* EffectControlLinearizer::LowerFindOrderedHashMapEntry(Node* node) {
     auto call_descriptor = Linkage::GetStubCallDescriptor(
         graph()->zone(), callable.descriptor(),
         callable.descriptor().GetStackParameterCount(), flags, properties);
-    return __ Call(call_descriptor, __ HeapConstant(callable.code()), table,
-                   key, __ NoContextConstant());
+    __ Goto(&done, __ Call(call_descriptor, __ HeapConstant(callable.code()),
+                           table, key, __ NoContextConstant()));
   }
+
+  __ Bind(&done);
+  return done.PhiAt(0);
 }
 
 Node* EffectControlLinearizer::ComputeUnseededHash(Node* value) {
@@ -6321,14 +6646,13 @@ Node* EffectControlLinearizer::ComputeUnseededHash(Node* value) {
   return value;
 }
 
-Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
-    Node* node) {
-  Node* table = NodeProperties::GetValueInput(node, 0);
-  Node* key = NodeProperties::GetValueInput(node, 1);
-
-  // Compute the integer hash code.
-  Node* hash = ChangeUint32ToUintPtr(ComputeUnseededHash(key));
-
+// Probes the bucket chain of {table} selected by {hash} for {key} and returns
+// the entry index (as a word), or OrderedHashMap::kNotFound. If {if_bailout}
+// is null, {key} is an untagged int32; otherwise {key} is an internalized
+// string, and the probe jumps to {if_bailout} when it meets a candidate that
+// can only be compared by content (a non-internalized string).
+Node* EffectControlLinearizer::BuildFindOrderedHashMapEntry(
+    Node* table, Node* key, Node* hash, GraphAssemblerLabel<0>* if_bailout) {
   Node* number_of_buckets = ChangeSmiToIntPtr(__ LoadField(
       AccessBuilder::ForOrderedHashMapOrSetNumberOfBuckets(), table));
   hash = __ WordAnd(hash, __ IntSub(number_of_buckets, __ IntPtrConstant(1)));
@@ -6359,20 +6683,39 @@ Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
 
     auto if_match = __ MakeLabel();
     auto if_notmatch = __ MakeLabel();
-    auto if_notsmi = __ MakeDeferredLabel();
-    __ GotoIfNot(ObjectIsSmi(candidate_key), &if_notsmi);
-    __ Branch(__ Word32Equal(ChangeSmiToInt32(candidate_key), key), &if_match,
-              &if_notmatch);
-
-    __ Bind(&if_notsmi);
-    __ GotoIfNot(
-        __ TaggedEqual(__ LoadField(AccessBuilder::ForMap(), candidate_key),
-                       __ HeapNumberMapConstant()),
-        &if_notmatch);
-    __ Branch(__ Float64Equal(__ LoadField(AccessBuilder::ForHeapNumberValue(),
-                                           candidate_key),
-                              __ ChangeInt32ToFloat64(key)),
-              &if_match, &if_notmatch);
+    if (if_bailout == nullptr) {
+      auto if_notsmi = __ MakeDeferredLabel();
+      __ GotoIfNot(ObjectIsSmi(candidate_key), &if_notsmi);
+      __ Branch(__ Word32Equal(ChangeSmiToInt32(candidate_key), key),
+                &if_match, &if_notmatch);
+
+      __ Bind(&if_notsmi);
+      __ GotoIfNot(
+          __ TaggedEqual(__ LoadField(AccessBuilder::ForMap(), candidate_key),
+                         __ HeapNumberMapConstant()),
+          &if_notmatch);
+      __ Branch(
+          __ Float64Equal(__ LoadField(AccessBuilder::ForHeapNumberValue(),
+                                       candidate_key),
+                          __ ChangeInt32ToFloat64(key)),
+          &if_match, &if_notmatch);
+    } else {
+      // Internalized strings are unique, so identity decides equality unless
+      // the candidate is a string that is not (yet) internalized.
+      __ GotoIf(__ TaggedEqual(candidate_key, key), &if_match);
+      __ GotoIf(ObjectIsSmi(candidate_key), &if_notmatch);
+      Node* candidate_instance_type = __ LoadField(
+          AccessBuilder::ForMapInstanceType(),
+          __ LoadField(AccessBuilder::ForMap(), candidate_key));
+      __ GotoIfNot(__ Uint32LessThan(candidate_instance_type,
+                                     __ Uint32Constant(FIRST_NONSTRING_TYPE)),
+                   &if_notmatch);
+      __ Branch(__ Word32Equal(
+                    __ Word32And(candidate_instance_type,
+                                 __ Int32Constant(kIsNotInternalizedMask)),
+                    __ Int32Constant(kInternalizedTag)),
+                &if_notmatch, if_bailout);
+    }
 
     __ Bind(&if_match);
     __ Goto(&done, entry);
@@ -6394,6 +6737,16 @@ Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
   return done.PhiAt(0);
 }
 
+Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
+    Node* node) {
+  Node* table = NodeProperties::GetValueInput(node, 0);
+  Node* key = NodeProperties::GetValueInput(node, 1);
+
+  // Compute the integer hash code.
+  Node* hash = ChangeUint32ToUintPtr(ComputeUnseededHash(key));
+  return BuildFindOrderedHashMapEntry(table, key, hash, nullptr);
+}
+
 Node* EffectControlLinearizer::LowerDateNow(Node* node) {
   Operator::Properties properties = Operator::kNoDeopt | Operator::kNoThrow;
   Runtime::FunctionId id = Runtime::kDateCurrentTime;
@@ -752,6 +752,41 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       current->SetEscaped(checked);
       break;
     }
+    case IrOpcode::kCheckClosure: {
+      // Closures that reach a call through a property or a local variable
+      // are guarded by a CheckClosure against the call site's feedback cell.
+      // If the closure was allocated locally, both its map and its feedback
+      // cell are known, so the check can be decided statically without
+      // forcing the closure (and its context) to escape.
+      Node* checked = current->ValueInput(0);
+      const VirtualObject* vobject = current->GetVirtualObject(checked);
+      Variable map_field;
+      Variable cell_field;
+      Node* map;
+      Node* cell;
+      if (vobject && !vobject->HasEscaped() &&
+          vobject->FieldAt(HeapObject::kMapOffset).To(&map_field) &&
+          vobject->FieldAt(JSFunction::kFeedbackCellOffset).To(&cell_field) &&
+          current->Get(map_field).To(&map) &&
+          current->Get(cell_field).To(&cell)) {
+        if (map && cell) {
+          Type const map_type = NodeProperties::GetType(map);
+          if (map_type.IsHeapConstant() &&
+              map_type.AsHeapConstant()->Ref().AsMap().instance_type() ==
+                  JS_FUNCTION_TYPE &&
+              HeapObjectMatcher(cell).Is(FeedbackCellOf(op))) {
+            current->SetReplacement(checked);
+            break;
+          }
+        } else {
+          // If the variables have no values, we have not reached the
+          // fixed-point yet.
+          break;
+        }
+      }
+      current->SetEscaped(checked);
+      break;
+    }
     case IrOpcode::kCompareMaps: {
       Node* object = current->ValueInput(0);
       const VirtualObject* vobject = current->GetVirtualObject(object);
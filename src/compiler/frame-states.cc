@@ -71,6 +71,9 @@ std::ostream& operator<<(std::ostream& os, FrameStateType type) {
     case FrameStateType::kJavaScriptBuiltinContinuationWithCatch:
       os << "JAVA_SCRIPT_BUILTIN_CONTINUATION_WITH_CATCH_FRAME";
       break;
+    case FrameStateType::kJSToWasmBuiltinContinuation:
+      os << "JS_TO_WASM_BUILTIN_CONTINUATION_FRAME";
+      break;
   }
   return os;
 }
@@ -110,7 +113,8 @@ FrameState CreateBuiltinContinuationFrameStateCommon(
     JSGraph* jsgraph, FrameStateType frame_type, Builtins::Name name,
     Node* closure, Node* context, Node** parameters, int parameter_count,
     Node* outer_frame_state,
-    Handle<SharedFunctionInfo> shared = Handle<SharedFunctionInfo>()) {
+    Handle<SharedFunctionInfo> shared = Handle<SharedFunctionInfo>(),
+    const wasm::FunctionSig* signature = nullptr) {
   Graph* const graph = jsgraph->graph();
   CommonOperatorBuilder* const common = jsgraph->common();
 
@@ -120,8 +124,10 @@ FrameState CreateBuiltinContinuationFrameStateCommon(
 
   BailoutId bailout_id = Builtins::GetContinuationBailoutId(name);
   const FrameStateFunctionInfo* state_info =
-      common->CreateFrameStateFunctionInfo(frame_type, parameter_count, 0,
-                                           shared);
+      signature ? common->CreateJSToWasmFrameStateFunctionInfo(
+                      frame_type, parameter_count, 0, shared, signature)
+                : common->CreateFrameStateFunctionInfo(
+                      frame_type, parameter_count, 0, shared);
   const Operator* op = common->FrameState(
       bailout_id, OutputFrameStateCombine::Ignore(), state_info);
   return FrameState(graph->NewNode(op, params_node, jsgraph->EmptyStateValues(),
@@ -218,6 +224,22 @@ FrameState CreateGenericLazyDeoptContinuationFrameState(
       ContinuationFrameStateMode::LAZY);
 }
 
+FrameState CreateJSToWasmBuiltinContinuationFrameState(
+    JSGraph* jsgraph, Node* context, Node* outer_frame_state,
+    const wasm::FunctionSig* signature) {
+  // The only parameter of the continuation is the result of the Wasm call,
+  // which is added by the deoptimizer.
+  DCHECK_EQ(Builtins::CallInterfaceDescriptorFor(
+                Builtins::kJSToWasmLazyDeoptContinuation)
+                .GetStackParameterCount(),
+            DeoptimizerParameterCountFor(ContinuationFrameStateMode::LAZY));
+  return CreateBuiltinContinuationFrameStateCommon(
+      jsgraph, FrameStateType::kJSToWasmBuiltinContinuation,
+      Builtins::kJSToWasmLazyDeoptContinuation, jsgraph->UndefinedConstant(),
+      context, nullptr, 0, outer_frame_state, Handle<SharedFunctionInfo>(),
+      signature);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -10,6 +10,7 @@
 #include "src/handles/handles.h"
 #include "src/objects/shared-function-info.h"
 #include "src/utils/utils.h"
+#include "src/wasm/value-type.h"
 
 namespace v8 {
 namespace internal {
@@ -68,9 +69,11 @@ enum class FrameStateType {
   kBuiltinContinuation,            // Represents a continuation to a stub.
   kJavaScriptBuiltinContinuation,  // Represents a continuation to a JavaScipt
                                    // builtin.
-  kJavaScriptBuiltinContinuationWithCatch  // Represents a continuation to a
-                                           // JavaScipt builtin with a catch
-                                           // handler.
+  kJavaScriptBuiltinContinuationWithCatch,  // Represents a continuation to a
+                                            // JavaScipt builtin with a catch
+                                            // handler.
+  kJSToWasmBuiltinContinuation  // Represents a lazy deopt continuation for a
+                                // JS to Wasm call.
 };
 
 class FrameStateFunctionInfo {
@@ -101,6 +104,23 @@ class FrameStateFunctionInfo {
   Handle<SharedFunctionInfo> const shared_info_;
 };
 
+class JSToWasmFrameStateFunctionInfo : public FrameStateFunctionInfo {
+ public:
+  JSToWasmFrameStateFunctionInfo(FrameStateType type, int parameter_count,
+                                 int local_count,
+                                 Handle<SharedFunctionInfo> shared_info,
+                                 const wasm::FunctionSig* signature)
+      : FrameStateFunctionInfo(type, parameter_count, local_count, shared_info),
+        signature_(signature) {
+    DCHECK_NOT_NULL(signature);
+  }
+
+  const wasm::FunctionSig* signature() const { return signature_; }
+
+ private:
+  const wasm::FunctionSig* const signature_;
+};
+
 
 class FrameStateInfo final {
  public:
@@ -166,6 +186,13 @@ FrameState CreateGenericLazyDeoptContinuationFrameState(
     JSGraph* graph, const SharedFunctionInfoRef& shared, Node* target,
     Node* context, Node* receiver, Node* outer_frame_state);
 
+// Creates the lazy deopt frame state for a call from optimized JavaScript
+// directly into Wasm code with the given {signature}. The deoptimizer turns the
+// untagged Wasm return value into a JavaScript value for the continuation.
+FrameState CreateJSToWasmBuiltinContinuationFrameState(
+    JSGraph* jsgraph, Node* context, Node* outer_frame_state,
+    const wasm::FunctionSig* signature);
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -573,6 +573,12 @@ TNode<Number> JSGraphAssembler::NumberSubtract(TNode<Number> lhs,
       graph()->NewNode(simplified()->NumberSubtract(), lhs, rhs));
 }
 
+TNode<Boolean> JSGraphAssembler::NumberEqual(TNode<Number> lhs,
+                                             TNode<Number> rhs) {
+  return AddNode<Boolean>(
+      graph()->NewNode(simplified()->NumberEqual(), lhs, rhs));
+}
+
 TNode<Boolean> JSGraphAssembler::NumberLessThan(TNode<Number> lhs,
                                                 TNode<Number> rhs) {
   return AddNode<Boolean>(
@@ -592,11 +598,20 @@ TNode<String> JSGraphAssembler::StringSubstring(TNode<String> string,
       simplified()->StringSubstring(), string, from, to, effect(), control()));
 }
 
+TNode<Boolean> JSGraphAssembler::NumberIsNaN(TNode<Number> value) {
+  return AddNode<Boolean>(graph()->NewNode(simplified()->NumberIsNaN(), value));
+}
+
 TNode<Boolean> JSGraphAssembler::ObjectIsCallable(TNode<Object> value) {
   return AddNode<Boolean>(
       graph()->NewNode(simplified()->ObjectIsCallable(), value));
 }
 
+TNode<Boolean> JSGraphAssembler::ObjectIsNumber(TNode<Object> value) {
+  return AddNode<Boolean>(
+      graph()->NewNode(simplified()->ObjectIsNumber(), value));
+}
+
 TNode<Boolean> JSGraphAssembler::ObjectIsUndetectable(TNode<Object> value) {
   return AddNode<Boolean>(
       graph()->NewNode(simplified()->ObjectIsUndetectable(), value));
@@ -676,6 +676,10 @@ class FunctionTemplateInfoRef : public HeapObjectRef {
   base::Optional<CallHandlerInfoRef> call_code() const;
   Address c_function() const;
   const CFunctionInfo* c_signature() const;
+  // All fast call overloads, in registration order. The first overload is
+  // the one returned by c_function() and c_signature().
+  ZoneVector<Address> c_functions() const;
+  ZoneVector<const CFunctionInfo*> c_signatures() const;
 
   HolderLookupResult LookupHolderOfExpectedType(
       MapRef receiver_map,
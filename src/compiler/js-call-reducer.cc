@@ -26,6 +26,7 @@
 #include "src/compiler/property-access-builder.h"
 #include "src/compiler/simplified-operator.h"
 #include "src/compiler/type-cache.h"
+#include "src/compiler/wasm-compiler.h"
 #include "src/ic/call-optimization.h"
 #include "src/logging/counters.h"
 #include "src/objects/arguments-inl.h"
@@ -35,6 +36,8 @@
 #include "src/objects/js-objects.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/ordered-hash-table.h"
+#include "src/trap-handler/trap-handler.h"
+#include "src/wasm/wasm-objects-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -700,6 +703,21 @@ class IteratingArrayBuiltinReducerAssembler : public JSCallReducerAssembler {
   TNode<Object> ReduceArrayPrototypeIndexOfIncludes(
       ElementsKind kind, ArrayIndexOfIncludesVariant variant);
 
+  // The typed array variants reuse the continuations of the Array builtins.
+  // These skip indices that are not present, which matches the typed array
+  // builtins stopping the iteration once the buffer is detached.
+  TNode<Object> ReduceTypedArrayPrototypeForEach(
+      ElementsKind kind, bool check_detached,
+      const SharedFunctionInfoRef& shared);
+  TNode<Object> ReduceTypedArrayPrototypeReduce(
+      ElementsKind kind, bool check_detached, ArrayReduceDirection direction,
+      const SharedFunctionInfoRef& shared);
+  TNode<Object> ReduceTypedArrayPrototypeIndexOfIncludes(
+      ElementsKind kind, bool check_detached,
+      ArrayIndexOfIncludesVariant variant);
+  TNode<Object> ReduceTypedArrayPrototypeFill(ElementsKind kind,
+                                              bool check_detached);
+
  private:
   // Returns {index,value}. Assumes that the map has not changed, but possibly
   // the length and backing store.
@@ -762,6 +780,56 @@ class IteratingArrayBuiltinReducerAssembler : public JSCallReducerAssembler {
     return LoadField<Smi>(AccessBuilder::ForFixedArrayLength(), o);
   }
 
+  TNode<Number> LoadJSTypedArrayLength(TNode<JSTypedArray> o) {
+    return LoadField<Number>(AccessBuilder::ForJSTypedArrayLength(), o);
+  }
+
+  // Deopts if the buffer of {o} was detached.
+  void CheckTypedArrayNotDetached(TNode<JSTypedArray> o) {
+    TNode<HeapObject> buffer =
+        LoadField<HeapObject>(AccessBuilder::ForJSArrayBufferViewBuffer(), o);
+    TNode<Number> bit_field =
+        LoadField<Number>(AccessBuilder::ForJSArrayBufferBitField(), buffer);
+    TNode<Number> was_detached = AddNode<Number>(graph()->NewNode(
+        simplified()->NumberBitwiseAnd(), bit_field,
+        NumberConstant(JSArrayBuffer::WasDetachedBit::kMask)));
+    AddNode(graph()->NewNode(
+        simplified()->CheckIf(DeoptimizeReason::kArrayBufferWasDetached,
+                              feedback()),
+        NumberEqual(was_detached, ZeroConstant()), effect(), control()));
+  }
+
+  // Returns {index,value}. The data pointers are reloaded on every access,
+  // since a previous callback might have moved an on-heap backing store.
+  std::pair<TNode<Number>, TNode<Number>> SafeLoadTypedElement(
+      ElementsKind kind, TNode<JSTypedArray> o, TNode<Number> index,
+      TNode<Number> length) {
+    index = CheckBounds(index, length);
+
+    TNode<HeapObject> buffer =
+        LoadField<HeapObject>(AccessBuilder::ForJSArrayBufferViewBuffer(), o);
+    Node* base_pointer =
+        LoadField(AccessBuilder::ForJSTypedArrayBasePointer(), o);
+    Node* external_pointer =
+        LoadField(AccessBuilder::ForJSTypedArrayExternalPointer(), o);
+    TNode<Number> value = AddNode<Number>(graph()->NewNode(
+        simplified()->LoadTypedElement(ExternalArrayTypeFor(kind)), buffer,
+        base_pointer, external_pointer, index, effect(), control()));
+    return std::make_pair(index, value);
+  }
+
+  static ExternalArrayType ExternalArrayTypeFor(ElementsKind kind) {
+    switch (kind) {
+#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype) \
+  case TYPE##_ELEMENTS:                           \
+    return kExternal##Type##Array;
+      TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
+      default:
+        UNREACHABLE();
+    }
+  }
+
   TNode<Boolean> HoleCheck(ElementsKind kind, TNode<Object> v) {
     return IsDoubleElementsKind(kind)
                ? NumberIsFloat64Hole(TNode<Number>::UncheckedCast(v))
@@ -880,16 +948,22 @@ class PromiseBuiltinReducerAssembler : public JSCallReducerAssembler {
   JSHeapBroker* const broker_;
 };
 
+struct FastApiCallFunction {
+  Address address;
+  const CFunctionInfo* signature;
+};
+
 class FastApiCallReducerAssembler : public JSCallReducerAssembler {
  public:
   FastApiCallReducerAssembler(
       JSCallReducer* reducer, Node* node,
-      const FunctionTemplateInfoRef function_template_info, Node* receiver,
-      Node* holder, const SharedFunctionInfoRef shared, Node* target,
-      const int arity, Node* effect)
+      const FunctionTemplateInfoRef function_template_info,
+      FastApiCallFunction c_function, Node* receiver, Node* holder,
+      const SharedFunctionInfoRef shared, Node* target, const int arity,
+      Node* effect)
       : JSCallReducerAssembler(reducer, node),
-        c_function_(function_template_info.c_function()),
-        c_signature_(function_template_info.c_signature()),
+        c_function_(c_function.address),
+        c_signature_(c_function.signature),
         function_template_info_(function_template_info),
         receiver_(receiver),
         holder_(holder),
@@ -1289,6 +1363,46 @@ IteratingArrayBuiltinReducerAssembler::ReduceArrayPrototypeForEach(
   return UndefinedConstant();
 }
 
+TNode<Object>
+IteratingArrayBuiltinReducerAssembler::ReduceTypedArrayPrototypeForEach(
+    ElementsKind kind, bool check_detached,
+    const SharedFunctionInfoRef& shared) {
+  FrameState outer_frame_state = FrameStateInput();
+  TNode<Context> context = ContextInput();
+  TNode<Object> target = TargetInput();
+  TNode<JSTypedArray> receiver = ReceiverInputAs<JSTypedArray>();
+  TNode<Object> fncallback = ArgumentOrUndefined(0);
+  TNode<Object> this_arg = ArgumentOrUndefined(1);
+
+  // The builtin throws on a detached receiver, let it do so.
+  if (check_detached) CheckTypedArrayNotDetached(receiver);
+  TNode<Number> original_length = LoadJSTypedArrayLength(receiver);
+
+  ForEachFrameStateParams frame_state_params{
+      jsgraph(), shared,     context,  target,         outer_frame_state,
+      receiver,  fncallback, this_arg, original_length};
+
+  ThrowIfNotCallable(fncallback, ForEachLoopLazyFrameState(frame_state_params,
+                                                           ZeroConstant()));
+
+  ForZeroUntil(original_length).Do([&](TNode<Number> k) {
+    Checkpoint(ForEachLoopEagerFrameState(frame_state_params, k));
+
+    // Deopt if the callback detached the buffer.
+    if (check_detached) CheckTypedArrayNotDetached(receiver);
+
+    TNode<Number> element;
+    std::tie(k, element) =
+        SafeLoadTypedElement(kind, receiver, k, original_length);
+
+    TNode<Number> next_k = NumberInc(k);
+    JSCall3(fncallback, this_arg, element, k, receiver,
+            ForEachLoopLazyFrameState(frame_state_params, next_k));
+  });
+
+  return UndefinedConstant();
+}
+
 namespace {
 
 struct ReduceFrameStateParams {
@@ -1467,6 +1581,88 @@ TNode<Object> IteratingArrayBuiltinReducerAssembler::ReduceArrayPrototypeReduce(
   return result;
 }
 
+TNode<Object>
+IteratingArrayBuiltinReducerAssembler::ReduceTypedArrayPrototypeReduce(
+    ElementsKind kind, bool check_detached, ArrayReduceDirection direction,
+    const SharedFunctionInfoRef& shared) {
+  FrameState outer_frame_state = FrameStateInput();
+  TNode<Context> context = ContextInput();
+  TNode<Object> target = TargetInput();
+  TNode<JSTypedArray> receiver = ReceiverInputAs<JSTypedArray>();
+  TNode<Object> fncallback = ArgumentOrUndefined(0);
+
+  ReduceFrameStateParams frame_state_params{
+      jsgraph(), shared, direction, context, target, outer_frame_state};
+
+  // The builtin throws on a detached receiver, let it do so.
+  if (check_detached) CheckTypedArrayNotDetached(receiver);
+  TNode<Number> original_length = LoadJSTypedArrayLength(receiver);
+
+  // Set up variable behavior depending on the reduction kind (left/right).
+  TNode<Number> k;
+  StepFunction1 step;
+  ConditionFunction1 cond;
+  TNode<Number> zero = ZeroConstant();
+  TNode<Number> one = OneConstant();
+  if (direction == ArrayReduceDirection::kLeft) {
+    k = zero;
+    step = [&](TNode<Number> i) { return NumberAdd(i, one); };
+    cond = [&](TNode<Number> i) { return NumberLessThan(i, original_length); };
+  } else {
+    k = NumberSubtract(original_length, one);
+    step = [&](TNode<Number> i) { return NumberSubtract(i, one); };
+    cond = [&](TNode<Number> i) { return NumberLessThanOrEqual(zero, i); };
+  }
+
+  ThrowIfNotCallable(
+      fncallback, ReducePreLoopLazyFrameState(frame_state_params, receiver,
+                                              fncallback, k, original_length));
+
+  // Set initial accumulator value.
+  TNode<Object> accumulator;
+  if (ArgumentCount() > 1) {
+    accumulator = Argument(1);  // Initial value specified by the user.
+  } else {
+    // Typed arrays have no holes, so the first (or last in the case of
+    // reduceRight) element is the initial value. If the array is empty,
+    // deopt and let the continuation throw the TypeError.
+    Checkpoint(ReducePreLoopEagerFrameState(frame_state_params, receiver,
+                                            fncallback, original_length));
+    CheckIf(cond(k), DeoptimizeReason::kNoInitialElement);
+
+    TNode<Number> element;
+    std::tie(k, element) =
+        SafeLoadTypedElement(kind, receiver, k, original_length);
+    accumulator = element;
+    k = step(k);
+  }
+
+  TNode<Object> result =
+      For1(k, cond, step, accumulator)
+          .Do([&](TNode<Number> k, TNode<Object>* accumulator) {
+            Checkpoint(ReduceLoopEagerFrameState(frame_state_params, receiver,
+                                                 fncallback, k, original_length,
+                                                 *accumulator));
+
+            // Deopt if the callback detached the buffer.
+            if (check_detached) CheckTypedArrayNotDetached(receiver);
+
+            TNode<Number> element;
+            std::tie(k, element) =
+                SafeLoadTypedElement(kind, receiver, k, original_length);
+
+            TNode<Number> next_k = step(k);
+            *accumulator = JSCall4(
+                fncallback, UndefinedConstant(), *accumulator, element, k,
+                receiver,
+                ReduceLoopLazyFrameState(frame_state_params, receiver,
+                                         fncallback, next_k, original_length));
+          })
+          .Value();
+
+  return result;
+}
+
 namespace {
 
 struct MapFrameStateParams {
@@ -2035,6 +2231,141 @@ IteratingArrayBuiltinReducerAssembler::ReduceArrayPrototypeIndexOfIncludes(
                context, elements, search_element, length, from_index);
 }
 
+TNode<Object>
+IteratingArrayBuiltinReducerAssembler::ReduceTypedArrayPrototypeIndexOfIncludes(
+    ElementsKind kind, bool check_detached,
+    ArrayIndexOfIncludesVariant variant) {
+  TNode<JSTypedArray> receiver = ReceiverInputAs<JSTypedArray>();
+  TNode<Object> search_element = ArgumentOrUndefined(0);
+  TNode<Number> from_index = ArgumentOrZero(1);
+
+  // The builtin throws on a detached receiver, let it do so.
+  if (check_detached) CheckTypedArrayNotDetached(receiver);
+  TNode<Number> length = LoadJSTypedArrayLength(receiver);
+
+  const bool have_from_index = ArgumentCount() > 1;
+  if (have_from_index) {
+    TNode<Smi> from_index_smi = CheckSmi(from_index);
+
+    // If the index is negative, it means the offset from the end and
+    // therefore needs to be added to the length. If the result is still
+    // negative, it needs to be clamped to 0.
+    TNode<Boolean> cond = NumberLessThan(from_index_smi, ZeroConstant());
+    from_index = SelectIf<Number>(cond)
+                     .Then(_ {
+                       return NumberMax(NumberAdd(length, from_index_smi),
+                                        ZeroConstant());
+                     })
+                     .Else(_ { return from_index_smi; })
+                     .ExpectFalse()
+                     .Value();
+  }
+
+  const bool is_includes_variant =
+      (variant == ArrayIndexOfIncludesVariant::kIncludes);
+  TNode<Object> if_not_found_value =
+      is_includes_variant ? TNode<Object>::UncheckedCast(FalseConstant())
+                          : TNode<Object>::UncheckedCast(MinusOneConstant());
+  auto out = MakeLabel(MachineRepresentation::kTagged);
+
+  // BigInt typed arrays are not handled here, so the elements are all Numbers
+  // and nothing else can ever be found.
+  GotoIfNot(ObjectIsNumber(search_element), &out, if_not_found_value);
+  TNode<Number> search_number =
+      TNode<Number>::UncheckedCast(TypeGuard(Type::Number(), search_element));
+
+  // Array.p.includes uses SameValueZero, which also matches NaN.
+  const bool match_nan = is_includes_variant && IsFixedFloatElementsKind(kind);
+  TNode<Boolean> search_is_nan;
+  if (match_nan) search_is_nan = NumberIsNaN(search_number);
+
+  ForBuilder0(
+      this, from_index,
+      [&](TNode<Number> k) { return NumberLessThan(k, length); },
+      [&](TNode<Number> k) { return NumberInc(k); })
+      .Do([&](TNode<Number> k) {
+        TNode<Number> element;
+        std::tie(k, element) = SafeLoadTypedElement(kind, receiver, k, length);
+
+        TNode<Object> if_found_value =
+            is_includes_variant ? TNode<Object>::UncheckedCast(TrueConstant())
+                                : TNode<Object>::UncheckedCast(k);
+        GotoIf(NumberEqual(element, search_number), &out, if_found_value);
+
+        if (match_nan) {
+          auto continue_label = MakeLabel();
+          GotoIfNot(search_is_nan, &continue_label);
+          GotoIf(NumberIsNaN(element), &out, if_found_value);
+          Goto(&continue_label);
+          Bind(&continue_label);
+        }
+      });
+
+  Goto(&out, if_not_found_value);
+
+  Bind(&out);
+  return out.PhiAt<Object>(0);
+}
+
+TNode<Object>
+IteratingArrayBuiltinReducerAssembler::ReduceTypedArrayPrototypeFill(
+    ElementsKind kind, bool check_detached) {
+  TNode<JSTypedArray> receiver = ReceiverInputAs<JSTypedArray>();
+  TNode<Object> value = ArgumentOrUndefined(0);
+
+  // The value is converted only once, before any element is written. Only
+  // Numbers and Oddballs are handled, so this never calls into user code.
+  TNode<Number> number = SpeculativeToNumber(value);
+  if (kind == UINT8_CLAMPED_ELEMENTS) {
+    number = AddNode<Number>(
+        graph()->NewNode(simplified()->NumberToUint8Clamped(), number));
+  }
+
+  TNode<Number> length = LoadJSTypedArrayLength(receiver);
+
+  // Relative indices are counted from the end if negative, and clamped to
+  // [0, length].
+  auto relative_index = [&](TNode<Object> index) {
+    TNode<Smi> index_smi = CheckSmi(index);
+    return SelectIf<Number>(NumberLessThan(index_smi, ZeroConstant()))
+        .Then(_ {
+          return NumberMax(NumberAdd(length, index_smi), ZeroConstant());
+        })
+        .Else(_ { return NumberMin(index_smi, length); })
+        .ExpectFalse()
+        .Value();
+  };
+  TNode<Number> start =
+      ArgumentCount() > 1 ? relative_index(Argument(1)) : ZeroConstant();
+  TNode<Number> end =
+      ArgumentCount() > 2 ? relative_index(Argument(2)) : length;
+
+  // The builtin throws on a detached receiver, let it do so.
+  if (check_detached) CheckTypedArrayNotDetached(receiver);
+
+  // Nothing in the loop can move the backing store, so the data pointers are
+  // loaded once.
+  TNode<HeapObject> buffer = LoadField<HeapObject>(
+      AccessBuilder::ForJSArrayBufferViewBuffer(), receiver);
+  Node* base_pointer =
+      LoadField(AccessBuilder::ForJSTypedArrayBasePointer(), receiver);
+  Node* external_pointer =
+      LoadField(AccessBuilder::ForJSTypedArrayExternalPointer(), receiver);
+
+  ForBuilder0(
+      this, start, [&](TNode<Number> k) { return NumberLessThan(k, end); },
+      [&](TNode<Number> k) { return NumberInc(k); })
+      .Do([&](TNode<Number> k) {
+        k = CheckBounds(k, length);
+        AddNode(graph()->NewNode(
+            simplified()->StoreTypedElement(ExternalArrayTypeFor(kind)),
+            buffer, base_pointer, external_pointer, k, number, effect(),
+            control()));
+      });
+
+  return receiver;
+}
+
 namespace {
 
 struct PromiseCtorFrameStateParams {
@@ -3280,6 +3611,69 @@ class IteratingArrayBuiltinHelper {
   ElementsKind elements_kind_;
 };
 
+// Wraps common setup code for iterating typed array builtins.
+class IteratingTypedArrayBuiltinHelper {
+ public:
+  IteratingTypedArrayBuiltinHelper(Node* node, JSHeapBroker* broker,
+                                   JSGraph* jsgraph,
+                                   CompilationDependencies* dependencies)
+      : receiver_(NodeProperties::GetValueInput(node, 1)),
+        effect_(NodeProperties::GetEffectInput(node)),
+        control_(NodeProperties::GetControlInput(node)),
+        inference_(broker, receiver_, effect_) {
+    if (!FLAG_turbo_inline_array_builtins) return;
+
+    DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
+    const CallParameters& p = CallParametersOf(node->op());
+    if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
+      return;
+    }
+
+    // Try to determine the {receiver} map.
+    if (!inference_.HaveMaps()) return;
+    if (!inference_.AllOfInstanceTypesAre(JS_TYPED_ARRAY_TYPE)) return;
+    MapHandles const& receiver_maps = inference_.GetMaps();
+
+    // All maps must agree on the elements kind, since it determines how the
+    // elements are loaded. BigInt elements are not supported.
+    elements_kind_ = MapRef(broker, receiver_maps[0]).elements_kind();
+    if (elements_kind_ == BIGINT64_ELEMENTS ||
+        elements_kind_ == BIGUINT64_ELEMENTS) {
+      return;
+    }
+    for (Handle<Map> map : receiver_maps) {
+      if (MapRef(broker, map).elements_kind() != elements_kind_) return;
+    }
+
+    // The elements kind of a typed array never changes, so there is no need
+    // to check the maps again after calling into user code.
+    inference_.RelyOnMapsPreferStability(dependencies, jsgraph, &effect_,
+                                         control_, p.feedback());
+
+    // Without the protector, the generated code must check for detached
+    // buffers explicitly.
+    check_detached_ = !dependencies->DependOnArrayBufferDetachingProtector();
+
+    can_reduce_ = true;
+  }
+
+  bool can_reduce() const { return can_reduce_; }
+  bool check_detached() const { return check_detached_; }
+  Effect effect() const { return effect_; }
+  Control control() const { return control_; }
+  MapInference* inference() { return &inference_; }
+  ElementsKind elements_kind() const { return elements_kind_; }
+
+ private:
+  bool can_reduce_ = false;
+  bool check_detached_ = true;
+  Node* receiver_;
+  Effect effect_;
+  Control control_;
+  MapInference inference_;
+  ElementsKind elements_kind_;
+};
+
 }  // namespace
 
 Reduction JSCallReducer::ReduceArrayForEach(
@@ -3438,6 +3832,97 @@ Reduction JSCallReducer::ReduceArrayIndexOf(Node* node) {
   return ReplaceWithSubgraph(&a, subgraph);
 }
 
+Reduction JSCallReducer::ReduceTypedArrayForEach(
+    Node* node, const SharedFunctionInfoRef& shared) {
+  DisallowHeapAccessIf disallow_heap_access(should_disallow_heap_access());
+  IteratingTypedArrayBuiltinHelper h(node, broker(), jsgraph(),
+                                     dependencies());
+  if (!h.can_reduce()) return h.inference()->NoChange();
+
+  IteratingArrayBuiltinReducerAssembler a(this, node);
+  a.InitializeEffectControl(h.effect(), h.control());
+  TNode<Object> subgraph = a.ReduceTypedArrayPrototypeForEach(
+      h.elements_kind(), h.check_detached(), shared);
+  return ReplaceWithSubgraph(&a, subgraph);
+}
+
+Reduction JSCallReducer::ReduceTypedArrayReduce(
+    Node* node, const SharedFunctionInfoRef& shared) {
+  DisallowHeapAccessIf disallow_heap_access(should_disallow_heap_access());
+  IteratingTypedArrayBuiltinHelper h(node, broker(), jsgraph(),
+                                     dependencies());
+  if (!h.can_reduce()) return h.inference()->NoChange();
+
+  IteratingArrayBuiltinReducerAssembler a(this, node);
+  a.InitializeEffectControl(h.effect(), h.control());
+  TNode<Object> subgraph = a.ReduceTypedArrayPrototypeReduce(
+      h.elements_kind(), h.check_detached(), ArrayReduceDirection::kLeft,
+      shared);
+  return ReplaceWithSubgraph(&a, subgraph);
+}
+
+Reduction JSCallReducer::ReduceTypedArrayReduceRight(
+    Node* node, const SharedFunctionInfoRef& shared) {
+  DisallowHeapAccessIf disallow_heap_access(should_disallow_heap_access());
+  IteratingTypedArrayBuiltinHelper h(node, broker(), jsgraph(),
+                                     dependencies());
+  if (!h.can_reduce()) return h.inference()->NoChange();
+
+  IteratingArrayBuiltinReducerAssembler a(this, node);
+  a.InitializeEffectControl(h.effect(), h.control());
+  TNode<Object> subgraph = a.ReduceTypedArrayPrototypeReduce(
+      h.elements_kind(), h.check_detached(), ArrayReduceDirection::kRight,
+      shared);
+  return ReplaceWithSubgraph(&a, subgraph);
+}
+
+// ES7 %TypedArray%.prototype.includes(searchElement[, fromIndex])
+// #sec-%typedarray%.prototype.includes
+Reduction JSCallReducer::ReduceTypedArrayIncludes(Node* node) {
+  DisallowHeapAccessIf disallow_heap_access(should_disallow_heap_access());
+  IteratingTypedArrayBuiltinHelper h(node, broker(), jsgraph(),
+                                     dependencies());
+  if (!h.can_reduce()) return h.inference()->NoChange();
+
+  IteratingArrayBuiltinReducerAssembler a(this, node);
+  a.InitializeEffectControl(h.effect(), h.control());
+  TNode<Object> subgraph = a.ReduceTypedArrayPrototypeIndexOfIncludes(
+      h.elements_kind(), h.check_detached(),
+      ArrayIndexOfIncludesVariant::kIncludes);
+  return ReplaceWithSubgraph(&a, subgraph);
+}
+
+// ES6 %TypedArray%.prototype.indexOf(searchElement[, fromIndex])
+// #sec-%typedarray%.prototype.indexof
+Reduction JSCallReducer::ReduceTypedArrayIndexOf(Node* node) {
+  DisallowHeapAccessIf disallow_heap_access(should_disallow_heap_access());
+  IteratingTypedArrayBuiltinHelper h(node, broker(), jsgraph(),
+                                     dependencies());
+  if (!h.can_reduce()) return h.inference()->NoChange();
+
+  IteratingArrayBuiltinReducerAssembler a(this, node);
+  a.InitializeEffectControl(h.effect(), h.control());
+  TNode<Object> subgraph = a.ReduceTypedArrayPrototypeIndexOfIncludes(
+      h.elements_kind(), h.check_detached(),
+      ArrayIndexOfIncludesVariant::kIndexOf);
+  return ReplaceWithSubgraph(&a, subgraph);
+}
+
+// ES6 %TypedArray%.prototype.fill(value[, start[, end]])
+// #sec-%typedarray%.prototype.fill
+Reduction JSCallReducer::ReduceTypedArrayFill(Node* node) {
+  DisallowHeapAccessIf disallow_heap_access(should_disallow_heap_access());
+  IteratingTypedArrayBuiltinHelper h(node, broker(), jsgraph(),
+                                     dependencies());
+  if (!h.can_reduce()) return h.inference()->NoChange();
+
+  IteratingArrayBuiltinReducerAssembler a(this, node);
+  a.InitializeEffectControl(h.effect(), h.control());
+  TNode<Object> subgraph =
+      a.ReduceTypedArrayPrototypeFill(h.elements_kind(), h.check_detached());
+  return ReplaceWithSubgraph(&a, subgraph);
+}
+
 Reduction JSCallReducer::ReduceArraySome(Node* node,
                                          const SharedFunctionInfoRef& shared) {
   DisallowHeapAccessIf disallow_heap_access(should_disallow_heap_access());
@@ -3453,8 +3938,9 @@ Reduction JSCallReducer::ReduceArraySome(Node* node,
   return ReplaceWithSubgraph(&a, subgraph);
 }
 
-#ifndef V8_ENABLE_FP_PARAMS_IN_C_LINKAGE
 namespace {
+
+#ifndef V8_ENABLE_FP_PARAMS_IN_C_LINKAGE
 bool HasFPParamsInSignature(const CFunctionInfo* c_signature) {
   for (unsigned int i = 0; i < c_signature->ArgumentCount(); ++i) {
     if (c_signature->ArgumentInfo(i).GetType() == CTypeInfo::Type::kFloat32 ||
@@ -3464,13 +3950,15 @@ bool HasFPParamsInSignature(const CFunctionInfo* c_signature) {
   }
   return false;
 }
-}  // namespace
 #endif
 
 #ifndef V8_TARGET_ARCH_64_BIT
-namespace {
 bool Has64BitIntegerParamsInSignature(const CFunctionInfo* c_signature) {
   for (unsigned int i = 0; i < c_signature->ArgumentCount(); ++i) {
+    if (c_signature->ArgumentInfo(i).GetSequenceType() !=
+        CTypeInfo::SequenceType::kScalar) {
+      continue;
+    }
     if (c_signature->ArgumentInfo(i).GetType() == CTypeInfo::Type::kInt64 ||
         c_signature->ArgumentInfo(i).GetType() == CTypeInfo::Type::kUint64) {
       return true;
@@ -3478,29 +3966,189 @@ bool Has64BitIntegerParamsInSignature(const CFunctionInfo* c_signature) {
   }
   return false;
 }
-}  // namespace
 #endif
 
-bool CanOptimizeFastCall(
-    const FunctionTemplateInfoRef& function_template_info) {
-  const CFunctionInfo* c_signature = function_template_info.c_signature();
+bool HasUnsupportedParamsInSignature(const CFunctionInfo* c_signature) {
+  for (unsigned int i = 0; i < c_signature->ArgumentCount(); ++i) {
+    CTypeInfo arg = c_signature->ArgumentInfo(i);
+    switch (arg.GetSequenceType()) {
+      case CTypeInfo::SequenceType::kScalar:
+        if (arg.GetType() == CTypeInfo::Type::kUint8) return true;
+        break;
+      case CTypeInfo::SequenceType::kIsTypedArray:
+        if (arg.GetType() == CTypeInfo::Type::kVoid ||
+            arg.GetType() == CTypeInfo::Type::kBool ||
+            arg.GetType() == CTypeInfo::Type::kV8Value) {
+          return true;
+        }
+        break;
+      case CTypeInfo::SequenceType::kIsOneByteString:
+        break;
+    }
+  }
+  return false;
+}
 
-  bool optimize_to_fast_call =
-      FLAG_turbo_fast_api_calls &&
-      function_template_info.c_function() != kNullAddress;
+bool CanOptimizeFastSignature(const CFunctionInfo* c_signature) {
+  if (HasUnsupportedParamsInSignature(c_signature)) return false;
 #ifndef V8_ENABLE_FP_PARAMS_IN_C_LINKAGE
-  optimize_to_fast_call =
-      optimize_to_fast_call && !HasFPParamsInSignature(c_signature);
-#else
-  USE(c_signature);
+  if (HasFPParamsInSignature(c_signature)) return false;
 #endif
 #ifndef V8_TARGET_ARCH_64_BIT
-  optimize_to_fast_call =
-      optimize_to_fast_call && !Has64BitIntegerParamsInSignature(c_signature);
+  if (Has64BitIntegerParamsInSignature(c_signature)) return false;
 #endif
-  return optimize_to_fast_call;
+  return true;
 }
 
+bool IsTypedArrayElementsKindFor(ElementsKind kind, CTypeInfo::Type type) {
+  switch (type) {
+    case CTypeInfo::Type::kUint8:
+      return kind == UINT8_ELEMENTS || kind == UINT8_CLAMPED_ELEMENTS;
+    case CTypeInfo::Type::kInt32:
+      return kind == INT32_ELEMENTS;
+    case CTypeInfo::Type::kUint32:
+      return kind == UINT32_ELEMENTS;
+    case CTypeInfo::Type::kInt64:
+      return kind == BIGINT64_ELEMENTS;
+    case CTypeInfo::Type::kUint64:
+      return kind == BIGUINT64_ELEMENTS;
+    case CTypeInfo::Type::kFloat32:
+      return kind == FLOAT32_ELEMENTS;
+    case CTypeInfo::Type::kFloat64:
+      return kind == FLOAT64_ELEMENTS;
+    case CTypeInfo::Type::kVoid:
+    case CTypeInfo::Type::kBool:
+    case CTypeInfo::Type::kV8Value:
+      return false;
+  }
+  UNREACHABLE();
+}
+
+// Returns whether {value} is known to be a Number, or a Boolean for bool
+// parameters, so that it fits the scalar {arg_type}. The graph is usually not
+// typed yet, so besides types this looks at constants and inferred maps.
+bool ArgumentMatchesFastApiScalar(JSHeapBroker* broker, Node* value,
+                                  Node* effect, CTypeInfo arg_type) {
+  const bool is_bool = arg_type.GetType() == CTypeInfo::Type::kBool;
+  if (NodeProperties::IsTyped(value)) {
+    Type type = NodeProperties::GetType(value);
+    if (type.Is(is_bool ? Type::Boolean() : Type::Number())) return true;
+  }
+  if (!is_bool && NumberMatcher(value).HasResolvedValue()) return true;
+  ZoneHandleSet<Map> maps;
+  if (NodeProperties::InferMapsUnsafe(broker, value, effect, &maps) ==
+      NodeProperties::kNoMaps) {
+    return false;
+  }
+  for (size_t i = 0; i < maps.size(); ++i) {
+    MapRef map(broker, maps[i]);
+    if (is_bool ? map.oddball_type() != OddballType::kBoolean
+                : !map.IsHeapNumberMap()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns whether {value} fits {arg_type}: scalars must be known Numbers or
+// Booleans, and the maps inferred for sequences must all fit the sequence
+// type. This is only used to pick an overload; the lowering checks the actual
+// value and calls the slow callback on mismatch, so unreliable maps are fine
+// here.
+bool ArgumentMatchesFastApiType(JSHeapBroker* broker, Node* value,
+                                Node* effect, CTypeInfo arg_type) {
+  if (arg_type.GetSequenceType() == CTypeInfo::SequenceType::kScalar) {
+    return ArgumentMatchesFastApiScalar(broker, value, effect, arg_type);
+  }
+  ZoneHandleSet<Map> maps;
+  if (NodeProperties::InferMapsUnsafe(broker, value, effect, &maps) ==
+      NodeProperties::kNoMaps) {
+    return false;
+  }
+  for (size_t i = 0; i < maps.size(); ++i) {
+    MapRef map(broker, maps[i]);
+    switch (arg_type.GetSequenceType()) {
+      case CTypeInfo::SequenceType::kIsTypedArray:
+        if (map.instance_type() != JS_TYPED_ARRAY_TYPE ||
+            !IsTypedArrayElementsKindFor(map.elements_kind(),
+                                         arg_type.GetType())) {
+          return false;
+        }
+        break;
+      case CTypeInfo::SequenceType::kIsOneByteString:
+        if (!map.IsStringMap()) return false;
+        break;
+      case CTypeInfo::SequenceType::kScalar:
+        UNREACHABLE();
+    }
+  }
+  return true;
+}
+
+// Picks the C function to call for the JSCall {node} among the fast
+// overloads registered on {function_template_info}. A single overload is
+// always used, regardless of the arity of the call. With several overloads
+// only those taking exactly {argc} JS arguments are considered. If more than
+// one has that arity, the first one whose parameters all fit the arguments
+// is chosen, and no fast call is made if none is known to fit, since an
+// overload that doesn't fit would just keep calling the slow callback.
+base::Optional<FastApiCallFunction> GetFastApiCallTarget(
+    JSHeapBroker* broker, FunctionTemplateInfoRef function_template_info,
+    Node* node, int argc, Node* effect) {
+  if (!FLAG_turbo_fast_api_calls) return base::nullopt;
+
+  ZoneVector<Address> functions = function_template_info.c_functions();
+  ZoneVector<const CFunctionInfo*> signatures =
+      function_template_info.c_signatures();
+  DCHECK_EQ(functions.size(), signatures.size());
+
+  if (functions.empty()) {
+    // Templates created before overloads were recorded only carry a single
+    // C function.
+    if (function_template_info.c_function() == kNullAddress) {
+      return base::nullopt;
+    }
+    functions.push_back(function_template_info.c_function());
+    signatures.push_back(function_template_info.c_signature());
+  }
+
+  if (functions.size() == 1) {
+    if (!CanOptimizeFastSignature(signatures[0])) return base::nullopt;
+    return FastApiCallFunction{functions[0], signatures[0]};
+  }
+
+  // Overloads are only told apart by the arguments if the arity doesn't
+  // already single one out.
+  int arity_matches = 0;
+  for (const CFunctionInfo* c_signature : signatures) {
+    // The receiver is passed as the first C argument.
+    if (static_cast<int>(c_signature->ArgumentCount()) - 1 == argc) {
+      arity_matches++;
+    }
+  }
+
+  JSCallNode n(node);
+  for (size_t i = 0; i < functions.size(); ++i) {
+    const CFunctionInfo* c_signature = signatures[i];
+    const int js_args_count =
+        static_cast<int>(c_signature->ArgumentCount()) - 1;  // receiver
+    if (js_args_count != argc) continue;
+    if (!CanOptimizeFastSignature(c_signature)) continue;
+
+    bool matches = true;
+    if (arity_matches > 1) {
+      for (int j = 0; j < js_args_count && matches; ++j) {
+        matches = ArgumentMatchesFastApiType(broker, n.Argument(j), effect,
+                                             c_signature->ArgumentInfo(j + 1));
+      }
+    }
+    if (matches) return FastApiCallFunction{functions[i], c_signature};
+  }
+  return base::nullopt;
+}
+
+}  // namespace
+
 Reduction JSCallReducer::ReduceCallApiFunction(
     Node* node, const SharedFunctionInfoRef& shared) {
   DisallowHeapAccessIf no_heap_access(should_disallow_heap_access());
@@ -3672,9 +4320,12 @@ Reduction JSCallReducer::ReduceCallApiFunction(
     return NoChange();
   }
 
-  if (CanOptimizeFastCall(function_template_info)) {
-    FastApiCallReducerAssembler a(this, node, function_template_info, receiver,
-                                  holder, shared, target, argc, effect);
+  base::Optional<FastApiCallFunction> c_function = GetFastApiCallTarget(
+      broker(), function_template_info, node, argc, effect);
+  if (c_function.has_value()) {
+    FastApiCallReducerAssembler a(this, node, function_template_info,
+                                  *c_function, receiver, holder, shared,
+                                  target, argc, effect);
     Node* fast_call_subgraph = a.ReduceFastApiCall();
     ReplaceWithSubgraph(&a, fast_call_subgraph);
 
@@ -3712,6 +4363,136 @@ Reduction JSCallReducer::ReduceCallApiFunction(
 
 namespace {
 
+bool CanInlineJSToWasmCall(const wasm::FunctionSig* sig) {
+  if (sig->return_count() > 1) return false;
+  for (wasm::ValueType type : sig->all()) {
+    switch (type.kind()) {
+      case wasm::ValueType::kI32:
+      case wasm::ValueType::kF32:
+      case wasm::ValueType::kF64:
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+// Calls to exported Wasm functions are lowered to a direct call to the jump
+// table slot of the function, replacing the JSToWasm wrapper. The arguments
+// are converted speculatively, and a lazy deopt during the call resumes in
+// the JSToWasmLazyDeoptContinuation builtin with the untagged return value.
+Reduction JSCallReducer::ReduceCallWasmFunction(Node* node,
+                                                const JSFunctionRef& function) {
+  if (should_disallow_heap_access()) return NoChange();
+
+  JSCallNode n(node);
+  CallParameters const& p = n.Parameters();
+  if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
+    return NoChange();
+  }
+  // TODO(wasm): Support exception edges by wiring the trap exception through
+  // the continuation frame state.
+  if (NodeProperties::IsExceptionalCall(node)) return NoChange();
+
+  Handle<JSFunction> object = function.object();
+  if (!WasmExportedFunction::IsWasmExportedFunction(*object)) {
+    return NoChange();
+  }
+  Handle<WasmExportedFunction> wasm_function =
+      Handle<WasmExportedFunction>::cast(object);
+  Handle<WasmInstanceObject> instance(wasm_function->instance(), isolate());
+  int const function_index = wasm_function->function_index();
+  if (function_index <
+      static_cast<int>(instance->module()->num_imported_functions)) {
+    return NoChange();
+  }
+  const wasm::FunctionSig* sig = wasm_function->sig();
+  if (!CanInlineJSToWasmCall(sig)) return NoChange();
+
+  // Stack parameters would be visited as tagged by the optimized frame of
+  // the caller, so only signatures passed entirely in registers qualify.
+  CallDescriptor* call_descriptor = GetWasmCallDescriptor(
+      graph()->zone(), sig, WasmGraphBuilder::kNoRetpoline, kWasmFunction,
+      true);
+  if (call_descriptor->StackParameterCount() != 0) return NoChange();
+
+  Node* context = n.context();
+  Effect effect = n.effect();
+  Control control = n.control();
+
+  // Convert the arguments to the Wasm parameter types.
+  int const parameter_count = static_cast<int>(sig->parameter_count());
+  int const input_count = parameter_count + 5;
+  Node** inputs = graph()->zone()->NewArray<Node*>(input_count);
+  int cursor = 0;
+  inputs[cursor++] = jsgraph()->ExternalConstant(
+      ExternalReference::FromRawAddress(wasm_function->GetWasmCallTarget()));
+  inputs[cursor++] = jsgraph()->HeapConstant(instance);
+  for (int i = 0; i < parameter_count; ++i) {
+    Node* value = effect = graph()->NewNode(
+        simplified()->SpeculativeToNumber(NumberOperationHint::kNumberOrOddball,
+                                          p.feedback()),
+        n.ArgumentOrUndefined(i, jsgraph()), effect, control);
+    if (sig->GetParam(i).kind() == wasm::ValueType::kI32) {
+      value = graph()->NewNode(simplified()->NumberToInt32(), value);
+    }
+    inputs[cursor++] = value;
+  }
+  inputs[cursor++] = CreateJSToWasmBuiltinContinuationFrameState(
+      jsgraph(), context, n.frame_state(), sig);
+
+  // Keep the thread-in-wasm flag consistent with what the JSToWasm wrapper
+  // does, so that the trap handler recognizes faults in the callee.
+  Node* flag_address = nullptr;
+  FieldAccess const flag_access = {
+      kUntaggedBase,      0,
+      MaybeHandle<Name>(), MaybeHandle<Map>(),
+      Type::Signed32(),   MachineType::Int32(),
+      kNoWriteBarrier};
+  if (trap_handler::IsTrapHandlerEnabled()) {
+    FieldAccess flag_address_access = AccessBuilder::ForExternalIntPtr();
+    flag_address_access.offset = Isolate::thread_in_wasm_flag_address_offset();
+    flag_address = effect = graph()->NewNode(
+        simplified()->LoadField(flag_address_access),
+        jsgraph()->ExternalConstant(ExternalReference::isolate_root(isolate())),
+        effect, control);
+    effect = graph()->NewNode(simplified()->StoreField(flag_access),
+                              flag_address, jsgraph()->OneConstant(), effect,
+                              control);
+  }
+
+  inputs[cursor++] = effect;
+  inputs[cursor++] = control;
+  DCHECK_EQ(cursor, input_count);
+  Node* call = effect = control = graph()->NewNode(
+      common()->Call(call_descriptor), input_count, inputs);
+
+  if (flag_address != nullptr) {
+    effect = graph()->NewNode(simplified()->StoreField(flag_access),
+                              flag_address, jsgraph()->ZeroConstant(), effect,
+                              control);
+  }
+
+  Node* value;
+  if (sig->return_count() == 0) {
+    value = jsgraph()->UndefinedConstant();
+  } else {
+    Type const type = sig->GetReturn().kind() == wasm::ValueType::kI32
+                          ? Type::Signed32()
+                          : Type::Number();
+    value = effect =
+        graph()->NewNode(common()->TypeGuard(type), call, effect, control);
+  }
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
+namespace {
+
 // Check whether elements aren't mutated; we play it extremely safe here by
 // explicitly checking that {node} is only used by {LoadField} or
 // {LoadElement}.
@@ -4039,6 +4820,11 @@ Reduction JSCallReducer::ReduceJSCall(Node* node) {
         return NoChange();
       }
 
+      if (FLAG_turbo_inline_js_wasm_calls) {
+        Reduction const r = ReduceCallWasmFunction(node, function);
+        if (r.Changed()) return r;
+      }
+
       return ReduceJSCall(node, function.shared());
     } else if (target_ref.IsJSBoundFunction()) {
       JSBoundFunctionRef function = target_ref.AsJSBoundFunction();
@@ -4376,6 +5162,18 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
           node, JS_TYPED_ARRAY_TYPE, AccessBuilder::ForJSTypedArrayLength());
     case Builtins::kTypedArrayPrototypeToStringTag:
       return ReduceTypedArrayPrototypeToStringTag(node);
+    case Builtins::kTypedArrayPrototypeForEach:
+      return ReduceTypedArrayForEach(node, shared);
+    case Builtins::kTypedArrayPrototypeReduce:
+      return ReduceTypedArrayReduce(node, shared);
+    case Builtins::kTypedArrayPrototypeReduceRight:
+      return ReduceTypedArrayReduceRight(node, shared);
+    case Builtins::kTypedArrayPrototypeIndexOf:
+      return ReduceTypedArrayIndexOf(node);
+    case Builtins::kTypedArrayPrototypeIncludes:
+      return ReduceTypedArrayIncludes(node);
+    case Builtins::kTypedArrayPrototypeFill:
+      return ReduceTypedArrayFill(node);
     case Builtins::kMathAbs:
       return ReduceMathUnary(node, simplified()->NumberAbs());
     case Builtins::kMathAcos:
@@ -4550,8 +5348,9 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
       return ReduceDateNow(node);
     case Builtins::kNumberConstructor:
       return ReduceNumberConstructor(node);
+    case Builtins::kBigIntAsIntN:
     case Builtins::kBigIntAsUintN:
-      return ReduceBigIntAsUintN(node);
+      return ReduceBigIntAsN(node, static_cast<Builtins::Name>(builtin_id));
     default:
       break;
   }
@@ -7715,7 +8514,10 @@ Reduction JSCallReducer::ReduceNumberConstructor(Node* node) {
   return Changed(node);
 }
 
-Reduction JSCallReducer::ReduceBigIntAsUintN(Node* node) {
+Reduction JSCallReducer::ReduceBigIntAsN(Node* node, Builtins::Name builtin) {
+  DCHECK(builtin == Builtins::kBigIntAsIntN ||
+         builtin == Builtins::kBigIntAsUintN);
+
   if (!jsgraph()->machine()->Is64()) return NoChange();
 
   JSCallNode n(node);
@@ -7737,7 +8539,10 @@ Reduction JSCallReducer::ReduceBigIntAsUintN(Node* node) {
     const int bits_value = static_cast<int>(matcher.ResolvedValue());
     value = effect = graph()->NewNode(simplified()->CheckBigInt(p.feedback()),
                                       value, effect, control);
-    value = graph()->NewNode(simplified()->BigIntAsUintN(bits_value), value);
+    const Operator* op = builtin == Builtins::kBigIntAsIntN
+                             ? simplified()->BigIntAsIntN(bits_value)
+                             : simplified()->BigIntAsUintN(bits_value);
+    value = graph()->NewNode(op, value);
     ReplaceWithValue(node, value, effect);
     return Replace(value);
   }
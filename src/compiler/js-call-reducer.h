@@ -73,6 +73,7 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
   Reduction ReduceBooleanConstructor(Node* node);
   Reduction ReduceCallApiFunction(Node* node,
                                   const SharedFunctionInfoRef& shared);
+  Reduction ReduceCallWasmFunction(Node* node, const JSFunctionRef& function);
   Reduction ReduceFunctionPrototypeApply(Node* node);
   Reduction ReduceFunctionPrototypeBind(Node* node);
   Reduction ReduceFunctionPrototypeCall(Node* node);
@@ -163,6 +164,15 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
   Reduction ReduceTypedArrayConstructor(Node* node,
                                         const SharedFunctionInfoRef& shared);
   Reduction ReduceTypedArrayPrototypeToStringTag(Node* node);
+  Reduction ReduceTypedArrayForEach(Node* node,
+                                    const SharedFunctionInfoRef& shared);
+  Reduction ReduceTypedArrayReduce(Node* node,
+                                   const SharedFunctionInfoRef& shared);
+  Reduction ReduceTypedArrayReduceRight(Node* node,
+                                        const SharedFunctionInfoRef& shared);
+  Reduction ReduceTypedArrayIndexOf(Node* node);
+  Reduction ReduceTypedArrayIncludes(Node* node);
+  Reduction ReduceTypedArrayFill(Node* node);
 
   Reduction ReduceForInsufficientFeedback(Node* node, DeoptimizeReason reason);
 
@@ -206,7 +216,7 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
   Reduction ReduceNumberParseInt(Node* node);
 
   Reduction ReduceNumberConstructor(Node* node);
-  Reduction ReduceBigIntAsUintN(Node* node);
+  Reduction ReduceBigIntAsN(Node* node, Builtins::Name builtin);
 
   // The pendant to ReplaceWithValue when using GraphAssembler-based reductions.
   Reduction ReplaceWithSubgraph(JSCallReducerAssembler* gasm, Node* subgraph);
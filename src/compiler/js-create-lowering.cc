@@ -118,7 +118,7 @@ Reduction JSCreateLowering::ReduceJSCreate(Node* node) {
 
   base::Optional<MapRef> initial_map =
       NodeProperties::GetJSCreateMap(broker(), node);
-  if (!initial_map.has_value()) return NoChange();
+  if (!initial_map.has_value()) return ReduceJSCreateWithOuterNewTarget(node);
 
   JSFunctionRef original_constructor =
       HeapObjectMatcher(new_target).Ref(broker()).AsJSFunction();
@@ -146,6 +146,110 @@ Reduction JSCreateLowering::ReduceJSCreate(Node* node) {
   return Changed(node);
 }
 
+// A derived class constructor that is optimized on its own (i.e. not inlined
+// into a {new} site) receives its new.target as a parameter, so the JSCreate
+// of an inlined super() call cannot be lowered based on a constant new
+// target. In the vast majority of cases new.target is the derived class
+// constructor itself though, so check for that and allocate the instance
+// inline with its initial map (the layout of which already accounts for the
+// fields of all classes in the chain via slack tracking), and fall back to
+// the FastNewObject builtin for further subclasses.
+Reduction JSCreateLowering::ReduceJSCreateWithOuterNewTarget(Node* node) {
+  DCHECK_EQ(IrOpcode::kJSCreate, node->opcode());
+  Node* const target = NodeProperties::GetValueInput(node, 0);
+  Node* const new_target = NodeProperties::GetValueInput(node, 1);
+  Node* const context = NodeProperties::GetContextInput(node);
+  Node* const frame_state = NodeProperties::GetFrameStateInput(node);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  Handle<JSFunction> closure_handle;
+  if (!closure().ToHandle(&closure_handle)) return NoChange();
+  JSFunctionRef function(broker(), closure_handle);
+  if (!IsDerivedConstructor(function.shared().kind())) return NoChange();
+
+  // Only the outermost new.target is a parameter, the inliner replaces the
+  // new.target of inlinees with the value passed by the caller.
+  if (new_target->opcode() != IrOpcode::kParameter) return NoChange();
+  int const parameter_count =
+      function.shared().internal_formal_parameter_count() + 1;
+  if (ParameterIndexOf(new_target->op()) !=
+      Linkage::GetJSCallNewTargetParamIndex(parameter_count)) {
+    return NoChange();
+  }
+
+  // We don't split exceptional JSCreate nodes for now.
+  if (NodeProperties::IsExceptionalCall(node)) return NoChange();
+
+  HeapObjectMatcher mtarget(target);
+  if (!mtarget.HasResolvedValue() || !mtarget.Ref(broker()).IsJSFunction()) {
+    return NoChange();
+  }
+  if (!function.map().has_prototype_slot() || !function.has_initial_map()) {
+    return NoChange();
+  }
+  if (!function.serialized()) {
+    TRACE_BROKER_MISSING(broker(), "initial map on " << function);
+    return NoChange();
+  }
+  MapRef initial_map = function.initial_map();
+  if (!initial_map.GetConstructor().equals(mtarget.Ref(broker()))) {
+    return NoChange();
+  }
+  SlackTrackingPrediction slack_tracking_prediction =
+      dependencies()->DependOnInitialMapInstanceSizePrediction(function);
+
+  Node* check = graph()->NewNode(simplified()->ReferenceEqual(), new_target,
+                                 jsgraph()->Constant(function));
+  Node* branch =
+      graph()->NewNode(common()->Branch(BranchHint::kTrue), check, control);
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* etrue;
+  Node* vtrue;
+  {
+    AllocationBuilder a(jsgraph(), effect, if_true);
+    a.Allocate(slack_tracking_prediction.instance_size());
+    a.Store(AccessBuilder::ForMap(), initial_map);
+    a.Store(AccessBuilder::ForJSObjectPropertiesOrHashKnownPointer(),
+            jsgraph()->EmptyFixedArrayConstant());
+    a.Store(AccessBuilder::ForJSObjectElements(),
+            jsgraph()->EmptyFixedArrayConstant());
+    for (int i = 0; i < slack_tracking_prediction.inobject_property_count();
+         ++i) {
+      a.Store(AccessBuilder::ForJSObjectInObjectProperty(initial_map, i),
+              jsgraph()->UndefinedConstant());
+    }
+    vtrue = etrue = a.Finish();
+  }
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* efalse = effect;
+  Node* vfalse;
+  {
+    Callable callable =
+        Builtins::CallableFor(jsgraph()->isolate(), Builtins::kFastNewObject);
+    auto call_descriptor = Linkage::GetStubCallDescriptor(
+        graph()->zone(), callable.descriptor(),
+        callable.descriptor().GetStackParameterCount(),
+        CallDescriptor::kNeedsFrameState, node->op()->properties());
+    vfalse = efalse = if_false =
+        graph()->NewNode(common()->Call(call_descriptor),
+                         jsgraph()->HeapConstant(callable.code()), target,
+                         new_target, context, frame_state, efalse, if_false);
+    vfalse = efalse = graph()->NewNode(common()->TypeGuard(Type::Object()),
+                                       vfalse, efalse, if_false);
+  }
+
+  control = graph()->NewNode(common()->Merge(2), if_true, if_false);
+  effect = graph()->NewNode(common()->EffectPhi(2), etrue, efalse, control);
+  Node* value =
+      graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2), vtrue,
+                       vfalse, control);
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 Reduction JSCreateLowering::ReduceJSCreateArguments(Node* node) {
   DCHECK_EQ(IrOpcode::kJSCreateArguments, node->opcode());
   CreateArgumentsType type = CreateArgumentsTypeOf(node->op());
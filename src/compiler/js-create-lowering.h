@@ -8,6 +8,7 @@
 #include "src/base/compiler-specific.h"
 #include "src/common/globals.h"
 #include "src/compiler/graph-reducer.h"
+#include "src/handles/maybe-handles.h"
 
 namespace v8 {
 namespace internal {
@@ -29,15 +30,20 @@ class SimplifiedOperatorBuilder;
 class SlackTrackingPrediction;
 
 // Lowers JSCreate-level operators to fast (inline) allocations.
+// If the {closure} being compiled is given, JSCreate nodes whose new target
+// is the outermost new.target are additionally lowered with a fast path for
+// the common case where new.target is the {closure} itself.
 class V8_EXPORT_PRIVATE JSCreateLowering final
     : public NON_EXPORTED_BASE(AdvancedReducer) {
  public:
   JSCreateLowering(Editor* editor, CompilationDependencies* dependencies,
-                   JSGraph* jsgraph, JSHeapBroker* broker, Zone* zone)
+                   JSGraph* jsgraph, JSHeapBroker* broker,
+                   MaybeHandle<JSFunction> closure, Zone* zone)
       : AdvancedReducer(editor),
         dependencies_(dependencies),
         jsgraph_(jsgraph),
         broker_(broker),
+        closure_(closure),
         zone_(zone) {}
   ~JSCreateLowering() final = default;
 
@@ -47,6 +53,7 @@ class V8_EXPORT_PRIVATE JSCreateLowering final
 
  private:
   Reduction ReduceJSCreate(Node* node);
+  Reduction ReduceJSCreateWithOuterNewTarget(Node* node);
   Reduction ReduceJSCreateArguments(Node* node);
   Reduction ReduceJSCreateArray(Node* node);
   Reduction ReduceJSCreateArrayIterator(Node* node);
@@ -118,11 +125,13 @@ class V8_EXPORT_PRIVATE JSCreateLowering final
   SimplifiedOperatorBuilder* simplified() const;
   CompilationDependencies* dependencies() const { return dependencies_; }
   JSHeapBroker* broker() const { return broker_; }
+  MaybeHandle<JSFunction> closure() const { return closure_; }
   Zone* zone() const { return zone_; }
 
   CompilationDependencies* const dependencies_;
   JSGraph* const jsgraph_;
   JSHeapBroker* const broker_;
+  MaybeHandle<JSFunction> const closure_;
   Zone* const zone_;
 };
 
@@ -254,6 +254,10 @@ class FunctionTemplateInfoData : public HeapObjectData {
   ObjectData* call_code() const { return call_code_; }
   Address c_function() const { return c_function_; }
   const CFunctionInfo* c_signature() const { return c_signature_; }
+  const ZoneVector<Address>& c_functions() const { return c_functions_; }
+  const ZoneVector<const CFunctionInfo*>& c_signatures() const {
+    return c_signatures_;
+  }
   KnownReceiversMap& known_receivers() { return known_receivers_; }
 
  private:
@@ -264,6 +268,8 @@ class FunctionTemplateInfoData : public HeapObjectData {
   ObjectData* call_code_ = nullptr;
   const Address c_function_;
   const CFunctionInfo* const c_signature_;
+  ZoneVector<Address> c_functions_;
+  ZoneVector<const CFunctionInfo*> c_signatures_;
   KnownReceiversMap known_receivers_;
 };
 
@@ -283,14 +289,34 @@ class CallHandlerInfoData : public HeapObjectData {
   ObjectData* data_ = nullptr;
 };
 
+namespace {
+
+void CollectCFunctionOverloads(FunctionTemplateInfo info,
+                               ZoneVector<Address>* c_functions,
+                               ZoneVector<const CFunctionInfo*>* c_signatures) {
+  FixedArray overloads = info.GetCFunctionOverloads();
+  DCHECK_EQ(overloads.length() % 2, 0);
+  for (int i = 0; i < overloads.length(); i += 2) {
+    c_functions->push_back(v8::ToCData<Address>(overloads.get(i)));
+    c_signatures->push_back(
+        v8::ToCData<const CFunctionInfo*>(overloads.get(i + 1)));
+  }
+}
+
+}  // namespace
+
 FunctionTemplateInfoData::FunctionTemplateInfoData(
     JSHeapBroker* broker, ObjectData** storage,
     Handle<FunctionTemplateInfo> object)
     : HeapObjectData(broker, storage, object),
       c_function_(v8::ToCData<Address>(object->GetCFunction())),
       c_signature_(v8::ToCData<CFunctionInfo*>(object->GetCSignature())),
+      c_functions_(broker->zone()),
+      c_signatures_(broker->zone()),
       known_receivers_(broker->zone()) {
   auto function_template_info = Handle<FunctionTemplateInfo>::cast(object);
+  CollectCFunctionOverloads(*function_template_info, &c_functions_,
+                            &c_signatures_);
   is_signature_undefined_ =
       function_template_info->signature().IsUndefined(broker->isolate());
   accept_any_receiver_ = function_template_info->accept_any_receiver();
@@ -3727,6 +3753,26 @@ const CFunctionInfo* FunctionTemplateInfoRef::c_signature() const {
   return HeapObjectRef::data()->AsFunctionTemplateInfo()->c_signature();
 }
 
+ZoneVector<Address> FunctionTemplateInfoRef::c_functions() const {
+  if (data_->should_access_heap()) {
+    ZoneVector<Address> c_functions(broker()->zone());
+    ZoneVector<const CFunctionInfo*> c_signatures(broker()->zone());
+    CollectCFunctionOverloads(*object(), &c_functions, &c_signatures);
+    return c_functions;
+  }
+  return HeapObjectRef::data()->AsFunctionTemplateInfo()->c_functions();
+}
+
+ZoneVector<const CFunctionInfo*> FunctionTemplateInfoRef::c_signatures() const {
+  if (data_->should_access_heap()) {
+    ZoneVector<Address> c_functions(broker()->zone());
+    ZoneVector<const CFunctionInfo*> c_signatures(broker()->zone());
+    CollectCFunctionOverloads(*object(), &c_functions, &c_signatures);
+    return c_signatures;
+  }
+  return HeapObjectRef::data()->AsFunctionTemplateInfo()->c_signatures();
+}
+
 bool StringRef::IsSeqString() const {
   IF_ACCESS_FROM_HEAP_C(IsSeqString);
   return data()->AsString()->is_seq_string();
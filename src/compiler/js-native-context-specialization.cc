@@ -1128,7 +1128,7 @@ Reduction JSNativeContextSpecialization::ReduceMinimorphicPropertyAccess(
 
 Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     Node* node, Node* value, NamedAccessFeedback const& feedback,
-    AccessMode access_mode, Node* key) {
+    FeedbackSource const& source, AccessMode access_mode, Node* key) {
   DCHECK(node->opcode() == IrOpcode::kJSLoadNamed ||
          node->opcode() == IrOpcode::kJSStoreNamed ||
          node->opcode() == IrOpcode::kJSLoadProperty ||
@@ -1231,7 +1231,8 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
       // null. It can't be a number, a string etc. So trying to build the
       // checks in the "else if" branch doesn't make sense.
       access_builder.BuildCheckMaps(lookup_start_object, &effect, control,
-                                    access_info.lookup_start_object_maps());
+                                    access_info.lookup_start_object_maps(),
+                                    source);
 
     } else if (!access_builder.TryBuildStringCheck(
                    broker(), access_info.lookup_start_object_maps(), &receiver,
@@ -1259,7 +1260,8 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
         Node* efalse = effect;
         {
           access_builder.BuildCheckMaps(receiver, &efalse, if_false,
-                                        access_info.lookup_start_object_maps());
+                                        access_info.lookup_start_object_maps(),
+                                        source);
         }
 
         control = graph()->NewNode(common()->Merge(2), if_true, if_false);
@@ -1267,7 +1269,8 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
             graph()->NewNode(common()->EffectPhi(2), etrue, efalse, control);
       } else {
         access_builder.BuildCheckMaps(receiver, &effect, control,
-                                      access_info.lookup_start_object_maps());
+                                      access_info.lookup_start_object_maps(),
+                                      source);
       }
     } else {
       // At least one of TryBuildStringCheck & TryBuildNumberCheck succeeded
@@ -1336,7 +1339,8 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
           // Last map check on the fallthrough control path, do a
           // conditional eager deoptimization exit here.
           access_builder.BuildCheckMaps(lookup_start_object, &this_effect,
-                                        this_control, lookup_start_object_maps);
+                                        this_control, lookup_start_object_maps,
+                                        source);
           fallthrough_control = nullptr;
 
           // Don't insert a MapGuard in this case, as the CheckMaps
@@ -1490,6 +1494,10 @@ Reduction JSNativeContextSpecialization::ReduceJSLoadNamed(Node* node) {
     }
   }
 
+  Reduction reduction = ReduceJSProxyNamedAccess(
+      node, name, nullptr, AccessMode::kLoad, p.language_mode());
+  if (reduction.Changed()) return reduction;
+
   if (!p.feedback().IsValid()) return NoChange();
   return ReducePropertyAccess(node, nullptr, name, jsgraph()->Dead(),
                               FeedbackSource(p.feedback()), AccessMode::kLoad);
@@ -1593,12 +1601,207 @@ Reduction JSNativeContextSpecialization::ReduceJSGetIterator(Node* node) {
 Reduction JSNativeContextSpecialization::ReduceJSStoreNamed(Node* node) {
   JSStoreNamedNode n(node);
   NamedAccess const& p = n.Parameters();
+  NameRef name(broker(), p.name());
+
+  Reduction reduction = ReduceJSProxyNamedAccess(
+      node, name, n.value(), AccessMode::kStore, p.language_mode());
+  if (reduction.Changed()) return reduction;
+
   if (!p.feedback().IsValid()) return NoChange();
-  return ReducePropertyAccess(node, nullptr, NameRef(broker(), p.name()),
-                              n.value(), FeedbackSource(p.feedback()),
+  return ReducePropertyAccess(node, nullptr, name, n.value(),
+                              FeedbackSource(p.feedback()),
                               AccessMode::kStore);
 }
 
+// Proxy [[Get]] and [[Set]] on a constant {proxy} receiver are lowered to a
+// direct call to the trap, which the inliner can then pick up. The property
+// access feedback for proxies carries no information about the handler, so
+// this only applies when the receiver itself is known.
+Reduction JSNativeContextSpecialization::ReduceJSProxyNamedAccess(
+    Node* node, NameRef const& name, Node* value, AccessMode access_mode,
+    LanguageMode language_mode) {
+  DCHECK(node->opcode() == IrOpcode::kJSLoadNamed ||
+         node->opcode() == IrOpcode::kJSStoreNamed);
+  DCHECK(access_mode == AccessMode::kLoad || access_mode == AccessMode::kStore);
+  if (!FLAG_turbo_inline_proxy_traps) return NoChange();
+  if (should_disallow_heap_access()) return NoChange();
+
+  Node* receiver = NodeProperties::GetValueInput(node, 0);
+  HeapObjectMatcher m(receiver);
+  if (!m.HasResolvedValue() || !m.ResolvedValue()->IsJSProxy()) {
+    return NoChange();
+  }
+  Handle<JSProxy> proxy = Handle<JSProxy>::cast(m.ResolvedValue());
+
+  // Leave accesses inside try-blocks to the generic path, since both the trap
+  // and the invariant checks below may throw.
+  if (NodeProperties::IsExceptionalCall(node)) return NoChange();
+
+  // Private symbols never reach the traps, and integer-indexed names would
+  // need an element lookup for the invariant check.
+  uint32_t index;
+  if (name.object()->IsPrivate() || name.object()->AsArrayIndex(&index)) {
+    return NoChange();
+  }
+
+  // A revoked proxy throws; let the generic path deal with that.
+  if (!proxy->handler().IsJSObject()) return NoChange();
+  Handle<JSObject> handler(JSObject::cast(proxy->handler()), isolate());
+  Handle<JSReceiver> target(JSReceiver::cast(proxy->target()), isolate());
+
+  // Look up the trap on the {handler}; only a constant function is inlined.
+  Handle<Name> trap_name = access_mode == AccessMode::kLoad
+                               ? factory()->get_string()
+                               : factory()->set_string();
+  AccessInfoFactory access_info_factory(broker(), dependencies(),
+                                        graph()->zone());
+  PropertyAccessInfo access_info =
+      access_info_factory.ComputePropertyAccessInfo(
+          handle(handler->map(), isolate()), trap_name, AccessMode::kLoad);
+  if (!access_info.IsDataConstant()) return NoChange();
+  Handle<JSObject> holder;
+  if (!access_info.holder().ToHandle(&holder)) holder = handler;
+  base::Optional<ObjectRef> trap_value =
+      JSObjectRef(broker(), holder)
+          .GetOwnDataProperty(access_info.field_representation(),
+                              access_info.field_index());
+  if (!trap_value.has_value() || !trap_value->IsJSFunction()) {
+    return NoChange();
+  }
+
+  // The trap result needs to be checked against the target's own property
+  // only if that property is non-configurable. If the target is an ordinary
+  // object with a stable map, we can tell statically and rely on the map
+  // staying the same; the lazy deopt continuation redoes the check if the
+  // trap changes the target.
+  bool needs_invariant_check = true;
+  if (target->IsJSObject()) {
+    Handle<Map> target_map(target->map(), isolate());
+    if (!target_map->IsSpecialReceiverMap() &&
+        !target_map->is_dictionary_map() && target_map->is_stable()) {
+      DescriptorArray descriptors =
+          target_map->instance_descriptors(kRelaxedLoad);
+      InternalIndex entry = descriptors.Search(*name.object(), *target_map);
+      if (entry.is_not_found() ||
+          descriptors.GetDetails(entry).IsConfigurable()) {
+        needs_invariant_check = false;
+      }
+    }
+  }
+
+  // All bailouts are done; record the dependencies of the trap lookup.
+  access_info.RecordDependencies(dependencies());
+  if (access_info.holder().ToHandle(&holder)) {
+    dependencies()->DependOnStablePrototypeChains(
+        access_info.lookup_start_object_maps(), kStartAtPrototype,
+        JSObjectRef(broker(), holder));
+  }
+  if (!needs_invariant_check) {
+    dependencies()->DependOnStableMap(
+        MapRef(broker(), handle(target->map(), isolate())));
+  }
+
+  Node* context = NodeProperties::GetContextInput(node);
+  Node* frame_state = NodeProperties::GetFrameStateInput(node);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  // Deoptimize if the {proxy} was revoked in the meantime; revocation is the
+  // only way for the handler and target to change.
+  Node* handler_constant = jsgraph()->Constant(ObjectRef(broker(), handler));
+  Node* proxy_handler = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSProxyHandler()), receiver,
+      effect, control);
+  Node* check = graph()->NewNode(simplified()->ReferenceEqual(),
+                                 proxy_handler, handler_constant);
+  effect = graph()->NewNode(
+      simplified()->CheckIf(DeoptimizeReason::kWrongHandler), check, effect,
+      control);
+
+  // The trap is a constant of the {handler}'s map, as long as the map stays
+  // the same.
+  PropertyAccessBuilder access_builder(jsgraph(), broker(), dependencies());
+  access_builder.BuildCheckMaps(handler_constant, &effect, control,
+                                access_info.lookup_start_object_maps());
+  Node* trap = jsgraph()->Constant(*trap_value);
+
+  Node* target_constant = jsgraph()->Constant(ObjectRef(broker(), target));
+  Node* name_constant = jsgraph()->Constant(name);
+  Node* feedback = jsgraph()->UndefinedConstant();
+  if (access_mode == AccessMode::kLoad) {
+    Node* parameters[] = {receiver, target_constant, name_constant};
+    Node* continuation_frame_state = CreateStubBuiltinContinuationFrameState(
+        jsgraph(), Builtins::kProxyGetPropertyLazyDeoptContinuation, context,
+        parameters, arraysize(parameters), frame_state,
+        ContinuationFrameStateMode::LAZY);
+    value = effect = control = graph()->NewNode(
+        javascript()->Call(JSCallNode::ArityForArgc(3), CallFrequency(),
+                           FeedbackSource(),
+                           ConvertReceiverMode::kNotNullOrUndefined),
+        trap, handler_constant, target_constant, name_constant, receiver,
+        feedback, context, continuation_frame_state, effect, control);
+    if (needs_invariant_check) {
+      value = effect = control = graph()->NewNode(
+          javascript()->CallRuntime(Runtime::kCheckProxyGetSetTrapResult, 4),
+          name_constant, target_constant, value,
+          jsgraph()->SmiConstant(JSProxy::kGet), context, frame_state, effect,
+          control);
+    }
+  } else {
+    Node* parameters[] = {receiver, target_constant, name_constant, value};
+    Node* continuation_frame_state = CreateStubBuiltinContinuationFrameState(
+        jsgraph(), Builtins::kProxySetPropertyLazyDeoptContinuation, context,
+        parameters, arraysize(parameters), frame_state,
+        ContinuationFrameStateMode::LAZY);
+    Node* trap_result = effect = control = graph()->NewNode(
+        javascript()->Call(JSCallNode::ArityForArgc(4), CallFrequency(),
+                           FeedbackSource(),
+                           ConvertReceiverMode::kNotNullOrUndefined),
+        trap, handler_constant, target_constant, name_constant, value,
+        receiver, feedback, context, continuation_frame_state, effect,
+        control);
+
+    if (needs_invariant_check || is_strict(language_mode)) {
+      Node* success = graph()->NewNode(simplified()->ToBoolean(), trap_result);
+      Node* branch = graph()->NewNode(common()->Branch(BranchHint::kTrue),
+                                      success, control);
+
+      Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+      Node* etrue = effect;
+      if (needs_invariant_check) {
+        etrue = if_true = graph()->NewNode(
+            javascript()->CallRuntime(Runtime::kCheckProxyGetSetTrapResult,
+                                      4),
+            name_constant, target_constant, value,
+            jsgraph()->SmiConstant(JSProxy::kSet), context, frame_state, etrue,
+            if_true);
+      }
+
+      Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+      Node* efalse = effect;
+      if (is_strict(language_mode)) {
+        // Throw if the trap reported failure in strict mode.
+        if_false = efalse = graph()->NewNode(
+            javascript()->CallRuntime(Runtime::kThrowTypeError, 3),
+            jsgraph()->Constant(static_cast<int>(
+                MessageTemplate::kProxyTrapReturnedFalsishFor)),
+            jsgraph()->HeapConstant(factory()->set_string()), name_constant,
+            context, frame_state, efalse, if_false);
+        if_false = graph()->NewNode(common()->Throw(), efalse, if_false);
+        NodeProperties::MergeControlToEnd(graph(), common(), if_false);
+        control = if_true;
+        effect = etrue;
+      } else {
+        control = graph()->NewNode(common()->Merge(2), if_true, if_false);
+        effect =
+            graph()->NewNode(common()->EffectPhi(2), etrue, efalse, control);
+      }
+    }
+  }
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 Reduction JSNativeContextSpecialization::ReduceJSStoreNamedOwn(Node* node) {
   JSStoreNamedOwnNode n(node);
   StoreNamedOwnParameters const& p = n.Parameters();
@@ -1687,8 +1890,8 @@ JSNativeContextSpecialization::TryRefineElementAccessFeedback(
 }
 
 Reduction JSNativeContextSpecialization::ReduceElementAccess(
-    Node* node, Node* index, Node* value,
-    ElementAccessFeedback const& feedback) {
+    Node* node, Node* index, Node* value, ElementAccessFeedback const& feedback,
+    FeedbackSource const& source) {
   DCHECK(node->opcode() == IrOpcode::kJSLoadProperty ||
          node->opcode() == IrOpcode::kJSStoreProperty ||
          node->opcode() == IrOpcode::kJSStoreInArrayLiteral ||
@@ -1817,12 +2020,13 @@ Reduction JSNativeContextSpecialization::ReduceElementAccess(
 
     // Perform map check on the {receiver}.
     access_builder.BuildCheckMaps(receiver, &effect, control,
-                                  access_info.lookup_start_object_maps());
+                                  access_info.lookup_start_object_maps(),
+                                  source);
 
     // Access the actual element.
     ValueEffectControl continuation =
         BuildElementAccess(receiver, index, value, effect, control, access_info,
-                           feedback.keyed_mode());
+                           feedback.keyed_mode(), source);
     value = continuation.value();
     effect = continuation.effect();
     control = continuation.control();
@@ -1866,7 +2070,7 @@ Reduction JSNativeContextSpecialization::ReduceElementAccess(
         // Last map check on the fallthrough control path, do a
         // conditional eager deoptimization exit here.
         access_builder.BuildCheckMaps(receiver, &this_effect, this_control,
-                                      receiver_maps);
+                                      receiver_maps, source);
         fallthrough_control = nullptr;
       } else {
         // Explicitly branch on the {receiver_maps}.
@@ -1890,7 +2094,8 @@ Reduction JSNativeContextSpecialization::ReduceElementAccess(
       // Access the actual element.
       ValueEffectControl continuation =
           BuildElementAccess(this_receiver, this_index, this_value, this_effect,
-                             this_control, access_info, feedback.keyed_mode());
+                             this_control, access_info, feedback.keyed_mode(),
+                             source);
       values.push_back(continuation.value());
       effects.push_back(continuation.effect());
       controls.push_back(continuation.control());
@@ -2020,7 +2225,7 @@ Reduction JSNativeContextSpecialization::ReducePropertyAccess(
           node,
           DeoptimizeReason::kInsufficientTypeFeedbackForGenericNamedAccess);
     case ProcessedFeedback::kNamedAccess:
-      return ReduceNamedAccess(node, value, feedback.AsNamedAccess(),
+      return ReduceNamedAccess(node, value, feedback.AsNamedAccess(), source,
                                access_mode, key);
     case ProcessedFeedback::kMinimorphicPropertyAccess:
       DCHECK_EQ(access_mode, AccessMode::kLoad);
@@ -2031,7 +2236,8 @@ Reduction JSNativeContextSpecialization::ReducePropertyAccess(
       DCHECK_EQ(feedback.AsElementAccess().keyed_mode().access_mode(),
                 access_mode);
       DCHECK_NE(node->opcode(), IrOpcode::kJSLoadNamedFromSuper);
-      return ReduceElementAccess(node, key, value, feedback.AsElementAccess());
+      return ReduceElementAccess(node, key, value, feedback.AsElementAccess(),
+                                 source);
     default:
       UNREACHABLE();
   }
@@ -2674,7 +2880,8 @@ ExternalArrayType GetArrayTypeFromElementsKind(ElementsKind kind) {
 JSNativeContextSpecialization::ValueEffectControl
 JSNativeContextSpecialization::BuildElementAccess(
     Node* receiver, Node* index, Node* value, Node* effect, Node* control,
-    ElementAccessInfo const& access_info, KeyedAccessMode const& keyed_mode) {
+    ElementAccessInfo const& access_info, KeyedAccessMode const& keyed_mode,
+    FeedbackSource const& source) {
   // TODO(bmeurer): We currently specialize based on elements kind. We should
   // also be able to properly support strings and other JSObjects here.
   ElementsKind elements_kind = access_info.elements_kind();
@@ -2780,7 +2987,7 @@ JSNativeContextSpecialization::BuildElementAccess(
       // Check that the {index} is in the valid range for the {receiver}.
       index = effect = graph()->NewNode(
           simplified()->CheckBounds(
-              FeedbackSource(), CheckBoundsFlag::kConvertStringAndMinusZero),
+              source, CheckBoundsFlag::kConvertStringAndMinusZero),
           index, length, effect, control);
       situation = kBoundsCheckDone;
     }
@@ -2972,7 +3179,7 @@ JSNativeContextSpecialization::BuildElementAccess(
       // Check that the {index} is in the valid range for the {receiver}.
       index = effect = graph()->NewNode(
           simplified()->CheckBounds(
-              FeedbackSource(), CheckBoundsFlag::kConvertStringAndMinusZero),
+              source, CheckBoundsFlag::kConvertStringAndMinusZero),
           index, length, effect, control);
     }
 
@@ -3217,7 +3424,7 @@ JSNativeContextSpecialization::BuildElementAccess(
                                    jsgraph()->OneConstant());
         index = effect = graph()->NewNode(
             simplified()->CheckBounds(
-                FeedbackSource(), CheckBoundsFlag::kConvertStringAndMinusZero),
+                source, CheckBoundsFlag::kConvertStringAndMinusZero),
             index, limit, effect, control);
 
         // Grow {elements} backing store if necessary.
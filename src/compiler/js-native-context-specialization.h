@@ -95,7 +95,8 @@ class V8_EXPORT_PRIVATE JSNativeContextSpecialization final
   Reduction ReduceJSToObject(Node* node);
 
   Reduction ReduceElementAccess(Node* node, Node* index, Node* value,
-                                ElementAccessFeedback const& feedback);
+                                ElementAccessFeedback const& feedback,
+                                FeedbackSource const& source);
   // In the case of non-keyed (named) accesses, pass the name as {static_name}
   // and use {nullptr} for {key} (load/store modes are irrelevant).
   Reduction ReducePropertyAccess(Node* node, Node* key,
@@ -104,7 +105,12 @@ class V8_EXPORT_PRIVATE JSNativeContextSpecialization final
                                  AccessMode access_mode);
   Reduction ReduceNamedAccess(Node* node, Node* value,
                               NamedAccessFeedback const& feedback,
+                              FeedbackSource const& source,
                               AccessMode access_mode, Node* key = nullptr);
+  // Inlines the "get" or "set" trap of a constant JSProxy receiver.
+  Reduction ReduceJSProxyNamedAccess(Node* node, NameRef const& name,
+                                     Node* value, AccessMode access_mode,
+                                     LanguageMode language_mode);
   Reduction ReduceMinimorphicPropertyAccess(
       Node* node, Node* value,
       MinimorphicLoadPropertyAccessFeedback const& feedback,
@@ -194,7 +200,8 @@ class V8_EXPORT_PRIVATE JSNativeContextSpecialization final
                                         Node* value, Node* effect,
                                         Node* control,
                                         ElementAccessInfo const& access_info,
-                                        KeyedAccessMode const& keyed_mode);
+                                        KeyedAccessMode const& keyed_mode,
+                                        FeedbackSource const& source);
 
   // Construct appropriate subgraph to load from a String.
   Node* BuildIndexedStringLoad(Node* receiver, Node* index, Node* length,
@@ -157,11 +157,20 @@ class JSSpeculativeBinopBuilder final {
   }
 
   const Operator* SpeculativeBigIntOp(BigIntOperationHint hint) {
+    FeedbackSource feedback(lowering_->feedback_vector(), slot_);
     switch (op_->opcode()) {
       case IrOpcode::kJSAdd:
-        return simplified()->SpeculativeBigIntAdd(hint);
+        return simplified()->SpeculativeBigIntAdd(hint, feedback);
       case IrOpcode::kJSSubtract:
-        return simplified()->SpeculativeBigIntSubtract(hint);
+        return simplified()->SpeculativeBigIntSubtract(hint, feedback);
+      case IrOpcode::kJSMultiply:
+        return simplified()->SpeculativeBigIntMultiply(hint, feedback);
+      case IrOpcode::kJSBitwiseAnd:
+        return simplified()->SpeculativeBigIntBitwiseAnd(hint, feedback);
+      case IrOpcode::kJSBitwiseOr:
+        return simplified()->SpeculativeBigIntBitwiseOr(hint, feedback);
+      case IrOpcode::kJSBitwiseXor:
+        return simplified()->SpeculativeBigIntBitwiseXor(hint, feedback);
       default:
         break;
     }
@@ -405,7 +414,11 @@ JSTypeHintLowering::LoweringResult JSTypeHintLowering::ReduceBinaryOperation(
         return LoweringResult::SideEffectFree(node, node, control);
       }
       if (op->opcode() == IrOpcode::kJSAdd ||
-          op->opcode() == IrOpcode::kJSSubtract) {
+          op->opcode() == IrOpcode::kJSSubtract ||
+          op->opcode() == IrOpcode::kJSMultiply ||
+          op->opcode() == IrOpcode::kJSBitwiseAnd ||
+          op->opcode() == IrOpcode::kJSBitwiseOr ||
+          op->opcode() == IrOpcode::kJSBitwiseXor) {
         if (Node* node = b.TryBuildBigIntBinop()) {
           return LoweringResult::SideEffectFree(node, node, control);
         }
@@ -10,7 +10,7 @@ namespace compiler {
 
 Node::OutOfLineInputs* Node::OutOfLineInputs::New(Zone* zone, int capacity) {
   size_t size =
-      sizeof(OutOfLineInputs) + capacity * (sizeof(Node*) + sizeof(Use));
+      sizeof(OutOfLineInputs) + capacity * (sizeof(ZoneNodePtr) + sizeof(Use));
   intptr_t raw_buffer =
       reinterpret_cast<intptr_t>(zone->Allocate<Node::OutOfLineInputs>(size));
   Node::OutOfLineInputs* outline =
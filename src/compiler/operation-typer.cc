@@ -576,6 +576,11 @@ Type OperationTyper::NumberSilenceNaN(Type type) {
   return type;
 }
 
+Type OperationTyper::BigIntAsIntN(Type type) {
+  DCHECK(type.Is(Type::BigInt()));
+  return Type::BigInt();
+}
+
 Type OperationTyper::BigIntAsUintN(Type type) {
   DCHECK(type.Is(Type::BigInt()));
   return Type::BigInt();
@@ -1135,6 +1140,21 @@ Type OperationTyper::BigIntSubtract(Type lhs, Type rhs) {
   return Type::BigInt();
 }
 
+#define BIGINT_BINOP(Name)                                 \
+  Type OperationTyper::Name(Type lhs, Type rhs) {          \
+    if (lhs.IsNone() || rhs.IsNone()) return Type::None(); \
+    return Type::BigInt();                                 \
+  }
+BIGINT_BINOP(BigIntMultiply)
+BIGINT_BINOP(BigIntBitwiseAnd)
+BIGINT_BINOP(BigIntBitwiseOr)
+BIGINT_BINOP(BigIntBitwiseXor)
+BIGINT_BINOP(SpeculativeBigIntMultiply)
+BIGINT_BINOP(SpeculativeBigIntBitwiseAnd)
+BIGINT_BINOP(SpeculativeBigIntBitwiseOr)
+BIGINT_BINOP(SpeculativeBigIntBitwiseXor)
+#undef BIGINT_BINOP
+
 Type OperationTyper::BigIntNegate(Type type) {
   if (type.IsNone()) return type;
   return Type::BigInt();
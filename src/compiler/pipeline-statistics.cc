@@ -51,6 +51,8 @@ void PipelineStatistics::CommonStats::End(
       diff->max_allocated_bytes_ + allocated_bytes_at_start_;
   diff->total_allocated_bytes_ =
       outer_zone_diff + scope_->GetTotalAllocatedBytes();
+  diff->total_compressed_allocated_bytes_ =
+      scope_->GetTotalCompressedAllocatedBytes();
   scope_.reset();
   timer_.Stop();
 }
@@ -1143,11 +1143,16 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
   // We also can't do this for native context independent code (yet).
   // TODO(mythria): Check if it is better to key the OSR cache on JSFunction and
   // allow context specialization for OSR code.
+  // If there are other closures of the function with separate feedback
+  // vectors, we also don't specialize, such that the resulting code can be
+  // shared with them via the optimized code cache on the native context.
   if (compilation_info()->closure()->raw_feedback_cell().map() ==
           ReadOnlyRoots(isolate).one_closure_cell_map() &&
       !compilation_info()->is_osr() &&
       !compilation_info()->IsNativeContextIndependent() &&
-      !compilation_info()->IsTurboprop()) {
+      !compilation_info()->IsTurboprop() &&
+      !(FLAG_turbo_share_optimized_code &&
+        compilation_info()->shared_info()->shares_optimized_code())) {
     compilation_info()->set_function_context_specializing();
     data_.ChooseSpecializationContext();
   }
@@ -1595,7 +1600,7 @@ struct TypedLoweringPhase {
                                               data->common(), temp_zone);
     JSCreateLowering create_lowering(&graph_reducer, data->dependencies(),
                                      data->jsgraph(), data->broker(),
-                                     temp_zone);
+                                     data->info()->closure(), temp_zone);
     JSTypedLowering typed_lowering(&graph_reducer, data->jsgraph(),
                                    data->broker(), temp_zone);
     ConstantFoldingReducer constant_folding_reducer(
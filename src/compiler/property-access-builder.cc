@@ -83,7 +83,7 @@ bool PropertyAccessBuilder::TryBuildNumberCheck(
 
 void PropertyAccessBuilder::BuildCheckMaps(
     Node* object, Node** effect, Node* control,
-    ZoneVector<Handle<Map>> const& maps) {
+    ZoneVector<Handle<Map>> const& maps, FeedbackSource const& feedback) {
   HeapObjectMatcher m(object);
   if (m.HasResolvedValue()) {
     MapRef object_map = m.Ref(broker()).map();
@@ -105,8 +105,8 @@ void PropertyAccessBuilder::BuildCheckMaps(
       flags |= CheckMapsFlag::kTryMigrateInstance;
     }
   }
-  *effect = graph()->NewNode(simplified()->CheckMaps(flags, map_set), object,
-                             *effect, control);
+  *effect = graph()->NewNode(simplified()->CheckMaps(flags, map_set, feedback),
+                             object, *effect, control);
 }
 
 Node* PropertyAccessBuilder::BuildCheckValue(Node* receiver, Effect* effect,
@@ -45,13 +45,17 @@ class PropertyAccessBuilder {
 
   // TODO(jgruber): Remove the untyped version once all uses are
   // updated.
+  // The {feedback} of the property access, if given, is attached to the check
+  // so that repeated deopts can mark the access site as generic.
   void BuildCheckMaps(Node* object, Node** effect, Node* control,
-                      ZoneVector<Handle<Map>> const& maps);
+                      ZoneVector<Handle<Map>> const& maps,
+                      FeedbackSource const& feedback = FeedbackSource());
   void BuildCheckMaps(Node* object, Effect* effect, Control control,
-                      ZoneVector<Handle<Map>> const& maps) {
+                      ZoneVector<Handle<Map>> const& maps,
+                      FeedbackSource const& feedback = FeedbackSource()) {
     Node* e = *effect;
     Node* c = control;
-    BuildCheckMaps(object, &e, c, maps);
+    BuildCheckMaps(object, &e, c, maps, feedback);
     *effect = e;
   }
   Node* BuildCheckValue(Node* receiver, Effect* effect, Control control,
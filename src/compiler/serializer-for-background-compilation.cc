@@ -237,6 +237,7 @@ namespace compiler {
   CONDITIONAL_JUMPS_LIST(V)           \
   IGNORED_BYTECODE_LIST(V)            \
   KILL_ENVIRONMENT_LIST(V)            \
+  SHORT_STAR_BYTECODE_LIST(V)         \
   UNARY_OP_LIST(V)                    \
   UNCONDITIONAL_JUMPS_LIST(V)         \
   UNREACHABLE_BYTECODE_LIST(V)
@@ -1318,9 +1319,9 @@ void SerializerForBackgroundCompilation::TraverseBytecode() {
     }
 
     switch (iterator.current_bytecode()) {
-#define DEFINE_BYTECODE_CASE(name)     \
-  case interpreter::Bytecode::k##name: \
-    Visit##name(&iterator);            \
+#define DEFINE_BYTECODE_CASE(name, ...) \
+  case interpreter::Bytecode::k##name:  \
+    Visit##name(&iterator);             \
     break;
       SUPPORTED_BYTECODE_LIST(DEFINE_BYTECODE_CASE)
 #undef DEFINE_BYTECODE_CASE
@@ -1695,6 +1696,16 @@ void SerializerForBackgroundCompilation::VisitStar(
   register_hints(reg).Reset(&environment()->accumulator_hints(), zone());
 }
 
+#define DEFINE_SHORT_STAR(Name, ...)                                         \
+  void SerializerForBackgroundCompilation::Visit##Name(                      \
+      BytecodeArrayIterator* iterator) {                                     \
+    interpreter::Register reg =                                              \
+        interpreter::Register::FromShortStar(interpreter::Bytecode::k##Name); \
+    register_hints(reg).Reset(&environment()->accumulator_hints(), zone());  \
+  }
+SHORT_STAR_BYTECODE_LIST(DEFINE_SHORT_STAR)
+#undef DEFINE_SHORT_STAR
+
 void SerializerForBackgroundCompilation::VisitMov(
     BytecodeArrayIterator* iterator) {
   interpreter::Register src = iterator->GetRegisterOperand(0);
@@ -955,6 +955,27 @@ class RepresentationSelector {
                          MachineRepresentation::kWord32);
   }
 
+  // Helper for speculative BigInt binops. If the result is only used as a
+  // Word64, the operation is performed on the truncated inputs with
+  // {word64_op}, otherwise on tagged BigInts with {bigint_op}.
+  template <Phase T>
+  void VisitSpeculativeBigIntBinop(Node* node, Truncation truncation,
+                                   const Operator* word64_op,
+                                   const Operator* bigint_op) {
+    DCHECK_EQ(2, node->op()->ValueInputCount());
+    if (truncation.IsUsedAsWord64()) {
+      VisitBinop<T>(node,
+                    UseInfo::CheckedBigIntTruncatingWord64(FeedbackSource{}),
+                    MachineRepresentation::kWord64);
+      if (lower<T>()) ChangeToPureOp(node, word64_op);
+    } else {
+      VisitBinop<T>(node,
+                    UseInfo::CheckedBigIntAsTaggedPointer(FeedbackSource{}),
+                    MachineRepresentation::kTaggedPointer);
+      if (lower<T>()) NodeProperties::ChangeOp(node, bigint_op);
+    }
+  }
+
   // Helper for unops of the I -> O variety.
   template <Phase T>
   void VisitUnop(Node* node, UseInfo input_use, MachineRepresentation output,
@@ -1734,12 +1755,19 @@ class RepresentationSelector {
         return MachineType::Float64();
       case CTypeInfo::Type::kV8Value:
         return MachineType::AnyTagged();
+      case CTypeInfo::Type::kUint8:
+        return MachineType::Uint8();
     }
   }
 
-  UseInfo UseInfoForFastApiCallArgument(CTypeInfo::Type type,
+  UseInfo UseInfoForFastApiCallArgument(CTypeInfo type,
                                         FeedbackSource const& feedback) {
-    switch (type) {
+    // Typed arrays and strings are checked and unpacked into a (pointer,
+    // length) view during effect control linearization.
+    if (type.GetSequenceType() != CTypeInfo::SequenceType::kScalar) {
+      return UseInfo::AnyTagged();
+    }
+    switch (type.GetType()) {
       case CTypeInfo::Type::kVoid:
         UNREACHABLE();
       case CTypeInfo::Type::kBool:
@@ -1757,6 +1785,8 @@ class RepresentationSelector {
         return UseInfo::CheckedNumberAsFloat64(kDistinguishZeros, feedback);
       case CTypeInfo::Type::kV8Value:
         return UseInfo::AnyTagged();
+      case CTypeInfo::Type::kUint8:
+        UNREACHABLE();
     }
   }
 
@@ -1781,7 +1811,7 @@ class RepresentationSelector {
     // Propagate representation information from TypeInfo.
     for (int i = 0; i < c_arg_count; i++) {
       arg_use_info[i] = UseInfoForFastApiCallArgument(
-          c_signature->ArgumentInfo(i).GetType(), op_params.feedback());
+          c_signature->ArgumentInfo(i), op_params.feedback());
       ProcessInput<T>(node, i + FastApiCallNode::kFastTargetInputCount,
                       arg_use_info[i]);
     }
@@ -2668,6 +2698,23 @@ class RepresentationSelector {
         }
         return;
       }
+      case IrOpcode::kBigIntAsIntN: {
+        ProcessInput<T>(node, 0, UseInfo::TruncatingWord64());
+        if (truncation.IsUsedAsWord64()) {
+          SetOutput<T>(node, MachineRepresentation::kWord64, Type::BigInt());
+          return;
+        }
+        // Word64 values are converted to BigInts as unsigned, so box the
+        // sign-extended result explicitly.
+        SetOutput<T>(node, MachineRepresentation::kTaggedPointer);
+        if (lower<T>()) {
+          Node* value = graph()->NewNode(node->op(), node->InputAt(0));
+          node->ReplaceInput(0, value);
+          NodeProperties::ChangeOp(
+              node, lowering->simplified()->ChangeInt64ToBigInt());
+        }
+        return;
+      }
       case IrOpcode::kBigIntAsUintN: {
         ProcessInput<T>(node, 0, UseInfo::TruncatingWord64());
         SetOutput<T>(node, MachineRepresentation::kWord64, Type::BigInt());
@@ -2859,41 +2906,40 @@ class RepresentationSelector {
         // but preserves type checking which may throw exceptions. Until this
         // is fully supported, we lower to int64 operations but keep pushing
         // type constraints.
-        if (truncation.IsUsedAsWord64()) {
-          VisitBinop<T>(
-              node, UseInfo::CheckedBigIntTruncatingWord64(FeedbackSource{}),
-              MachineRepresentation::kWord64);
-          if (lower<T>()) {
-            ChangeToPureOp(node, lowering->machine()->Int64Add());
-          }
-        } else {
-          VisitBinop<T>(node,
-                        UseInfo::CheckedBigIntAsTaggedPointer(FeedbackSource{}),
-                        MachineRepresentation::kTaggedPointer);
-          if (lower<T>()) {
-            NodeProperties::ChangeOp(node, lowering->simplified()->BigIntAdd());
-          }
-        }
-        return;
+        return VisitSpeculativeBigIntBinop<T>(
+            node, truncation, lowering->machine()->Int64Add(),
+            lowering->simplified()->BigIntAdd(
+                BigIntOperationParametersOf(node->op()).feedback()));
       }
       case IrOpcode::kSpeculativeBigIntSubtract: {
-        if (truncation.IsUsedAsWord64()) {
-          VisitBinop<T>(
-              node, UseInfo::CheckedBigIntTruncatingWord64(FeedbackSource{}),
-              MachineRepresentation::kWord64);
-          if (lower<T>()) {
-            ChangeToPureOp(node, lowering->machine()->Int64Sub());
-          }
-        } else {
-          VisitBinop<T>(node,
-                        UseInfo::CheckedBigIntAsTaggedPointer(FeedbackSource{}),
-                        MachineRepresentation::kTaggedPointer);
-          if (lower<T>()) {
-            NodeProperties::ChangeOp(node,
-                                     lowering->simplified()->BigIntSubtract());
-          }
-        }
-        return;
+        return VisitSpeculativeBigIntBinop<T>(
+            node, truncation, lowering->machine()->Int64Sub(),
+            lowering->simplified()->BigIntSubtract(
+                BigIntOperationParametersOf(node->op()).feedback()));
+      }
+      case IrOpcode::kSpeculativeBigIntMultiply: {
+        return VisitSpeculativeBigIntBinop<T>(
+            node, truncation, lowering->machine()->Int64Mul(),
+            lowering->simplified()->BigIntMultiply(
+                BigIntOperationParametersOf(node->op()).feedback()));
+      }
+      case IrOpcode::kSpeculativeBigIntBitwiseAnd: {
+        return VisitSpeculativeBigIntBinop<T>(
+            node, truncation, lowering->machine()->Word64And(),
+            lowering->simplified()->BigIntBitwiseAnd(
+                BigIntOperationParametersOf(node->op()).feedback()));
+      }
+      case IrOpcode::kSpeculativeBigIntBitwiseOr: {
+        return VisitSpeculativeBigIntBinop<T>(
+            node, truncation, lowering->machine()->Word64Or(),
+            lowering->simplified()->BigIntBitwiseOr(
+                BigIntOperationParametersOf(node->op()).feedback()));
+      }
+      case IrOpcode::kSpeculativeBigIntBitwiseXor: {
+        return VisitSpeculativeBigIntBinop<T>(
+            node, truncation, lowering->machine()->Word64Xor(),
+            lowering->simplified()->BigIntBitwiseXor(
+                BigIntOperationParametersOf(node->op()).feedback()));
       }
       case IrOpcode::kSpeculativeBigIntNegate: {
         if (truncation.IsUsedAsWord64()) {
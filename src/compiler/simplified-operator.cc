@@ -617,6 +617,31 @@ NumberOperationParameters const& NumberOperationParametersOf(
   return OpParameter<NumberOperationParameters>(op);
 }
 
+bool operator==(BigIntOperationParameters const& lhs,
+                BigIntOperationParameters const& rhs) {
+  return lhs.hint() == rhs.hint() && lhs.feedback() == rhs.feedback();
+}
+
+size_t hash_value(BigIntOperationParameters const& p) {
+  FeedbackSource::Hash feedback_hash;
+  return base::hash_combine(p.hint(), feedback_hash(p.feedback()));
+}
+
+std::ostream& operator<<(std::ostream& os, BigIntOperationParameters const& p) {
+  return os << p.hint() << ", " << p.feedback();
+}
+
+BigIntOperationParameters const& BigIntOperationParametersOf(
+    Operator const* op) {
+  DCHECK(op->opcode() == IrOpcode::kSpeculativeBigIntAdd ||
+         op->opcode() == IrOpcode::kSpeculativeBigIntSubtract ||
+         op->opcode() == IrOpcode::kSpeculativeBigIntMultiply ||
+         op->opcode() == IrOpcode::kSpeculativeBigIntBitwiseAnd ||
+         op->opcode() == IrOpcode::kSpeculativeBigIntBitwiseOr ||
+         op->opcode() == IrOpcode::kSpeculativeBigIntBitwiseXor);
+  return OpParameter<BigIntOperationParameters>(op);
+}
+
 size_t hash_value(AllocateParameters info) {
   return base::hash_combine(info.type(),
                             static_cast<int>(info.allocation_type()));
@@ -785,6 +810,7 @@ bool operator==(CheckMinusZeroParameters const& lhs,
   V(ChangeTaggedToBit, Operator::kNoProperties, 1, 0)              \
   V(ChangeBitToTagged, Operator::kNoProperties, 1, 0)              \
   V(TruncateBigIntToUint64, Operator::kNoProperties, 1, 0)         \
+  V(ChangeInt64ToBigInt, Operator::kNoProperties, 1, 0)            \
   V(ChangeUint64ToBigInt, Operator::kNoProperties, 1, 0)           \
   V(TruncateTaggedToBit, Operator::kNoProperties, 1, 0)            \
   V(TruncateTaggedPointerToBit, Operator::kNoProperties, 1, 0)     \
@@ -826,8 +852,6 @@ bool operator==(CheckMinusZeroParameters const& lhs,
   V(PoisonIndex, Operator::kNoProperties, 1, 0)
 
 #define EFFECT_DEPENDENT_OP_LIST(V)                       \
-  V(BigIntAdd, Operator::kNoProperties, 2, 1)             \
-  V(BigIntSubtract, Operator::kNoProperties, 2, 1)        \
   V(StringCharCodeAt, Operator::kNoProperties, 2, 1)      \
   V(StringCodePointAt, Operator::kNoProperties, 2, 1)     \
   V(StringFromCodePointAt, Operator::kNoProperties, 2, 1) \
@@ -1309,6 +1333,13 @@ const Operator* SimplifiedOperatorBuilder::RuntimeAbort(AbortReason reason) {
       static_cast<int>(reason));                // parameter
 }
 
+const Operator* SimplifiedOperatorBuilder::BigIntAsIntN(int bits) {
+  CHECK(0 <= bits && bits <= 64);
+
+  return zone()->New<Operator1<int>>(IrOpcode::kBigIntAsIntN, Operator::kPure,
+                                     "BigIntAsIntN", 1, 0, 0, 1, 0, 0, bits);
+}
+
 const Operator* SimplifiedOperatorBuilder::BigIntAsUintN(int bits) {
   CHECK(0 <= bits && bits <= 64);
 
@@ -1550,19 +1581,68 @@ const Operator* SimplifiedOperatorBuilder::CheckFloat64Hole(
 }
 
 const Operator* SimplifiedOperatorBuilder::SpeculativeBigIntAdd(
-    BigIntOperationHint hint) {
-  return zone()->New<Operator1<BigIntOperationHint>>(
-      IrOpcode::kSpeculativeBigIntAdd, Operator::kFoldable | Operator::kNoThrow,
-      "SpeculativeBigIntAdd", 2, 1, 1, 1, 1, 0, hint);
+    BigIntOperationHint hint, const FeedbackSource& feedback) {
+  return zone()->New<Operator1<BigIntOperationParameters>>(
+      IrOpcode::kSpeculativeBigIntAdd,
+      Operator::kFoldable | Operator::kNoThrow,
+      "SpeculativeBigIntAdd", 2, 1, 1, 1, 1, 0,
+      BigIntOperationParameters(hint, feedback));
 }
 
 const Operator* SimplifiedOperatorBuilder::SpeculativeBigIntSubtract(
-    BigIntOperationHint hint) {
-  return zone()->New<Operator1<BigIntOperationHint>>(
+    BigIntOperationHint hint, const FeedbackSource& feedback) {
+  return zone()->New<Operator1<BigIntOperationParameters>>(
       IrOpcode::kSpeculativeBigIntSubtract,
-      Operator::kFoldable | Operator::kNoThrow, "SpeculativeBigIntSubtract", 2,
-      1, 1, 1, 1, 0, hint);
-}
+      Operator::kFoldable | Operator::kNoThrow,
+      "SpeculativeBigIntSubtract", 2, 1, 1, 1, 1, 0,
+      BigIntOperationParameters(hint, feedback));
+}
+
+const Operator* SimplifiedOperatorBuilder::SpeculativeBigIntMultiply(
+    BigIntOperationHint hint, const FeedbackSource& feedback) {
+  return zone()->New<Operator1<BigIntOperationParameters>>(
+      IrOpcode::kSpeculativeBigIntMultiply,
+      Operator::kFoldable | Operator::kNoThrow,
+      "SpeculativeBigIntMultiply", 2, 1, 1, 1, 1, 0,
+      BigIntOperationParameters(hint, feedback));
+}
+
+const Operator* SimplifiedOperatorBuilder::SpeculativeBigIntBitwiseAnd(
+    BigIntOperationHint hint, const FeedbackSource& feedback) {
+  return zone()->New<Operator1<BigIntOperationParameters>>(
+      IrOpcode::kSpeculativeBigIntBitwiseAnd,
+      Operator::kFoldable | Operator::kNoThrow,
+      "SpeculativeBigIntBitwiseAnd", 2, 1, 1, 1, 1, 0,
+      BigIntOperationParameters(hint, feedback));
+}
+
+const Operator* SimplifiedOperatorBuilder::SpeculativeBigIntBitwiseOr(
+    BigIntOperationHint hint, const FeedbackSource& feedback) {
+  return zone()->New<Operator1<BigIntOperationParameters>>(
+      IrOpcode::kSpeculativeBigIntBitwiseOr,
+      Operator::kFoldable | Operator::kNoThrow,
+      "SpeculativeBigIntBitwiseOr", 2, 1, 1, 1, 1, 0,
+      BigIntOperationParameters(hint, feedback));
+}
+
+const Operator* SimplifiedOperatorBuilder::SpeculativeBigIntBitwiseXor(
+    BigIntOperationHint hint, const FeedbackSource& feedback) {
+  return zone()->New<Operator1<BigIntOperationParameters>>(
+      IrOpcode::kSpeculativeBigIntBitwiseXor,
+      Operator::kFoldable | Operator::kNoThrow,
+      "SpeculativeBigIntBitwiseXor", 2, 1, 1, 1, 1, 0,
+      BigIntOperationParameters(hint, feedback));
+}
+
+#define BIGINT_BINOP(Name)                                                   \
+  const Operator* SimplifiedOperatorBuilder::Name(                           \
+      const FeedbackSource& feedback) {                                      \
+    return zone()->New<Operator1<CheckParameters>>(                          \
+        IrOpcode::k##Name, Operator::kEliminatable, #Name, 2, 1, 1, 1, 1, 0, \
+        CheckParameters(feedback));                                          \
+  }
+SIMPLIFIED_BIGINT_BINOP_LIST(BIGINT_BINOP)
+#undef BIGINT_BINOP
 
 const Operator* SimplifiedOperatorBuilder::SpeculativeBigIntNegate(
     BigIntOperationHint hint) {
@@ -1690,7 +1770,10 @@ CheckParameters const& CheckParametersOf(Operator const* op) {
     return OpParameter<CheckBoundsParameters>(op).check_parameters();
   }
 #define MAKE_OR(name, arg2, arg3) op->opcode() == IrOpcode::k##name ||
-  CHECK((CHECKED_WITH_FEEDBACK_OP_LIST(MAKE_OR) false));
+#define MAKE_BIGINT_OR(name) op->opcode() == IrOpcode::k##name ||
+  CHECK((CHECKED_WITH_FEEDBACK_OP_LIST(MAKE_OR)
+             SIMPLIFIED_BIGINT_BINOP_LIST(MAKE_BIGINT_OR) false));
+#undef MAKE_BIGINT_OR
 #undef MAKE_OR
   return OpParameter<CheckParameters>(op);
 }
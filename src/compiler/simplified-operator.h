@@ -599,6 +599,28 @@ bool operator==(NumberOperationParameters const&,
 const NumberOperationParameters& NumberOperationParametersOf(const Operator* op)
     V8_WARN_UNUSED_RESULT;
 
+class BigIntOperationParameters {
+ public:
+  BigIntOperationParameters(BigIntOperationHint hint,
+                            const FeedbackSource& feedback)
+      : hint_(hint), feedback_(feedback) {}
+
+  BigIntOperationHint hint() const { return hint_; }
+  const FeedbackSource& feedback() const { return feedback_; }
+
+ private:
+  BigIntOperationHint hint_;
+  FeedbackSource feedback_;
+};
+
+size_t hash_value(BigIntOperationParameters const&);
+V8_EXPORT_PRIVATE std::ostream& operator<<(std::ostream&,
+                                           const BigIntOperationParameters&);
+bool operator==(BigIntOperationParameters const&,
+                BigIntOperationParameters const&);
+const BigIntOperationParameters& BigIntOperationParametersOf(const Operator* op)
+    V8_WARN_UNUSED_RESULT;
+
 int FormalParameterCountOf(const Operator* op) V8_WARN_UNUSED_RESULT;
 
 class AllocateParameters {
@@ -780,8 +802,12 @@ class V8_EXPORT_PRIVATE SimplifiedOperatorBuilder final
 
   const Operator* NumberSilenceNaN();
 
-  const Operator* BigIntAdd();
-  const Operator* BigIntSubtract();
+  const Operator* BigIntAdd(const FeedbackSource& feedback);
+  const Operator* BigIntSubtract(const FeedbackSource& feedback);
+  const Operator* BigIntMultiply(const FeedbackSource& feedback);
+  const Operator* BigIntBitwiseAnd(const FeedbackSource& feedback);
+  const Operator* BigIntBitwiseOr(const FeedbackSource& feedback);
+  const Operator* BigIntBitwiseXor(const FeedbackSource& feedback);
   const Operator* BigIntNegate();
 
   const Operator* SpeculativeSafeIntegerAdd(NumberOperationHint hint);
@@ -803,9 +829,20 @@ class V8_EXPORT_PRIVATE SimplifiedOperatorBuilder final
   const Operator* SpeculativeNumberLessThanOrEqual(NumberOperationHint hint);
   const Operator* SpeculativeNumberEqual(NumberOperationHint hint);
 
-  const Operator* SpeculativeBigIntAdd(BigIntOperationHint hint);
-  const Operator* SpeculativeBigIntSubtract(BigIntOperationHint hint);
+  const Operator* SpeculativeBigIntAdd(BigIntOperationHint hint,
+                                       const FeedbackSource& feedback);
+  const Operator* SpeculativeBigIntSubtract(BigIntOperationHint hint,
+                                            const FeedbackSource& feedback);
+  const Operator* SpeculativeBigIntMultiply(BigIntOperationHint hint,
+                                            const FeedbackSource& feedback);
+  const Operator* SpeculativeBigIntBitwiseAnd(BigIntOperationHint hint,
+                                              const FeedbackSource& feedback);
+  const Operator* SpeculativeBigIntBitwiseOr(BigIntOperationHint hint,
+                                             const FeedbackSource& feedback);
+  const Operator* SpeculativeBigIntBitwiseXor(BigIntOperationHint hint,
+                                              const FeedbackSource& feedback);
   const Operator* SpeculativeBigIntNegate(BigIntOperationHint hint);
+  const Operator* BigIntAsIntN(int bits);
   const Operator* BigIntAsUintN(int bits);
 
   const Operator* ReferenceEqual();
@@ -873,6 +910,7 @@ class V8_EXPORT_PRIVATE SimplifiedOperatorBuilder final
   const Operator* ChangeTaggedToBit();
   const Operator* ChangeBitToTagged();
   const Operator* TruncateBigIntToUint64();
+  const Operator* ChangeInt64ToBigInt();
   const Operator* ChangeUint64ToBigInt();
   const Operator* TruncateTaggedToWord32();
   const Operator* TruncateTaggedToFloat64();
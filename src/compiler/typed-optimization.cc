@@ -188,10 +188,84 @@ Reduction TypedOptimization::ReduceMaybeGrowFastElements(Node* node) {
   return NoChange();
 }
 
+namespace {
+
+// Checks whether {condition} being {true} (or {false} if {negated}) implies
+// that {index} < {length}.
+bool ImpliesIndexLessThanLength(Node* condition, bool negated, Node* index,
+                                Node* length) {
+  switch (condition->opcode()) {
+    case IrOpcode::kNumberLessThan:
+    case IrOpcode::kSpeculativeNumberLessThan:
+      // index < length
+      return !negated && condition->InputAt(0) == index &&
+             condition->InputAt(1) == length;
+    case IrOpcode::kNumberLessThanOrEqual:
+    case IrOpcode::kSpeculativeNumberLessThanOrEqual:
+      // !(length <= index); the caller ensures neither side is NaN.
+      return negated && condition->InputAt(0) == length &&
+             condition->InputAt(1) == index;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+bool TypedOptimization::IsDominatedByBoundsCheck(Node* node) {
+  Node* const index = NodeProperties::GetValueInput(node, 0);
+  Node* const length = NodeProperties::GetValueInput(node, 1);
+  if (!NodeProperties::GetType(index).Is(type_cache_->kPositiveSafeInteger) ||
+      !NodeProperties::GetType(length).Is(Type::OrderedNumber())) {
+    return false;
+  }
+  // Walk up the control chain for as long as every node has a unique control
+  // predecessor; every IfTrue/IfFalse we pass on the way dominates {node}.
+  // The comparison is on the same SSA values as the {node}, so intervening
+  // side effects cannot invalidate it. This catches the loop condition of
+  // the usual counted loops over typed arrays and JSArrays, once load
+  // elimination has unified the length loads in the loop header and body.
+  static const int kMaxControlChainLength = 32;
+  Node* control = NodeProperties::GetControlInput(node);
+  for (int i = 0; i < kMaxControlChainLength; ++i) {
+    switch (control->opcode()) {
+      case IrOpcode::kIfTrue:
+      case IrOpcode::kIfFalse: {
+        Node* const branch = NodeProperties::GetControlInput(control);
+        if (ImpliesIndexLessThanLength(
+                NodeProperties::GetValueInput(branch, 0),
+                control->opcode() == IrOpcode::kIfFalse, index, length)) {
+          return true;
+        }
+        control = NodeProperties::GetControlInput(branch);
+        break;
+      }
+      case IrOpcode::kLoop:
+      case IrOpcode::kMerge:
+      case IrOpcode::kStart:
+      case IrOpcode::kDead:
+        return false;
+      default:
+        if (control->op()->ControlInputCount() != 1) return false;
+        control = NodeProperties::GetControlInput(control);
+        break;
+    }
+  }
+  return false;
+}
+
 Reduction TypedOptimization::ReduceCheckBounds(Node* node) {
   CheckBoundsParameters const& p = CheckBoundsParametersOf(node->op());
   Node* const input = NodeProperties::GetValueInput(node, 0);
   Type const input_type = NodeProperties::GetType(input);
+  if (IsDominatedByBoundsCheck(node)) {
+    // Turn the {node} into a TypeGuard, which keeps the narrowed type of the
+    // index and the position in the effect chain, but never deoptimizes.
+    node->RemoveInput(1);
+    NodeProperties::ChangeOp(
+        node, common()->TypeGuard(NodeProperties::GetType(node)));
+    return Changed(node);
+  }
   if (p.flags() & CheckBoundsFlag::kConvertStringAndMinusZero &&
       !input_type.Maybe(Type::String()) &&
       !input_type.Maybe(Type::MinusZero())) {
@@ -897,6 +971,10 @@ Factory* TypedOptimization::factory() const {
 
 Graph* TypedOptimization::graph() const { return jsgraph()->graph(); }
 
+CommonOperatorBuilder* TypedOptimization::common() const {
+  return jsgraph()->common();
+}
+
 SimplifiedOperatorBuilder* TypedOptimization::simplified() const {
   return jsgraph()->simplified();
 }
@@ -19,6 +19,7 @@ class Isolate;
 namespace compiler {
 
 // Forward declarations.
+class CommonOperatorBuilder;
 class CompilationDependencies;
 class JSGraph;
 class SimplifiedOperatorBuilder;
@@ -67,6 +68,10 @@ class V8_EXPORT_PRIVATE TypedOptimization final
   Reduction ReduceSpeculativeNumberBinop(Node* node);
   Reduction ReduceSpeculativeNumberComparison(Node* node);
 
+  // Returns true if the CheckBounds {node} is dominated by a branch that
+  // already proves that its index is within bounds.
+  bool IsDominatedByBoundsCheck(Node* node);
+
   Reduction TryReduceStringComparisonOfStringFromSingleCharCode(
       Node* comparison, Node* from_char_code, Type constant_type,
       bool inverted);
@@ -78,6 +83,7 @@ class V8_EXPORT_PRIVATE TypedOptimization final
   Reduction ReduceJSToNumberInput(Node* input);
 
   SimplifiedOperatorBuilder* simplified() const;
+  CommonOperatorBuilder* common() const;
   Factory* factory() const;
   Graph* graph() const;
 
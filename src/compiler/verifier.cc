@@ -953,17 +953,26 @@ void Verifier::Visitor::Check(Node* node, const AllNodes& all) {
       break;
     case IrOpcode::kSpeculativeBigIntAdd:
     case IrOpcode::kSpeculativeBigIntSubtract:
+    case IrOpcode::kSpeculativeBigIntMultiply:
+    case IrOpcode::kSpeculativeBigIntBitwiseAnd:
+    case IrOpcode::kSpeculativeBigIntBitwiseOr:
+    case IrOpcode::kSpeculativeBigIntBitwiseXor:
       CheckTypeIs(node, Type::BigInt());
       break;
     case IrOpcode::kSpeculativeBigIntNegate:
       CheckTypeIs(node, Type::BigInt());
       break;
+    case IrOpcode::kBigIntAsIntN:
     case IrOpcode::kBigIntAsUintN:
       CheckValueInputIs(node, 0, Type::BigInt());
       CheckTypeIs(node, Type::BigInt());
       break;
     case IrOpcode::kBigIntAdd:
     case IrOpcode::kBigIntSubtract:
+    case IrOpcode::kBigIntMultiply:
+    case IrOpcode::kBigIntBitwiseAnd:
+    case IrOpcode::kBigIntBitwiseOr:
+    case IrOpcode::kBigIntBitwiseXor:
       CheckValueInputIs(node, 0, Type::BigInt());
       CheckValueInputIs(node, 1, Type::BigInt());
       CheckTypeIs(node, Type::BigInt());
@@ -1406,6 +1415,7 @@ void Verifier::Visitor::Check(Node* node, const AllNodes& all) {
       CheckValueInputIs(node, 0, Type::BigInt());
       CheckTypeIs(node, Type::BigInt());
       break;
+    case IrOpcode::kChangeInt64ToBigInt:
     case IrOpcode::kChangeUint64ToBigInt:
       CheckValueInputIs(node, 0, Type::BigInt());
       CheckTypeIs(node, Type::BigInt());
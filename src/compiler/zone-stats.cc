@@ -13,6 +13,8 @@ namespace compiler {
 ZoneStats::StatsScope::StatsScope(ZoneStats* zone_stats)
     : zone_stats_(zone_stats),
       total_allocated_bytes_at_start_(zone_stats->GetTotalAllocatedBytes()),
+      total_compressed_allocated_bytes_at_start_(
+          zone_stats->GetTotalCompressedAllocatedBytes()),
       max_allocated_bytes_(0) {
   zone_stats_->stats_.push_back(this);
   for (Zone* zone : zone_stats_->zones_) {
@@ -51,6 +53,11 @@ size_t ZoneStats::StatsScope::GetTotalAllocatedBytes() {
          total_allocated_bytes_at_start_;
 }
 
+size_t ZoneStats::StatsScope::GetTotalCompressedAllocatedBytes() {
+  return zone_stats_->GetTotalCompressedAllocatedBytes() -
+         total_compressed_allocated_bytes_at_start_;
+}
+
 void ZoneStats::StatsScope::ZoneReturned(Zone* zone) {
   size_t current_total = GetCurrentAllocatedBytes();
   // Update max.
@@ -63,7 +70,10 @@ void ZoneStats::StatsScope::ZoneReturned(Zone* zone) {
 }
 
 ZoneStats::ZoneStats(AccountingAllocator* allocator)
-    : max_allocated_bytes_(0), total_deleted_bytes_(0), allocator_(allocator) {}
+    : max_allocated_bytes_(0),
+      total_deleted_bytes_(0),
+      total_deleted_compressed_bytes_(0),
+      allocator_(allocator) {}
 
 ZoneStats::~ZoneStats() {
   DCHECK(zones_.empty());
@@ -86,6 +96,19 @@ size_t ZoneStats::GetTotalAllocatedBytes() const {
   return total_deleted_bytes_ + GetCurrentAllocatedBytes();
 }
 
+size_t ZoneStats::GetCurrentCompressedAllocatedBytes() const {
+  size_t total = 0;
+  for (Zone* zone : zones_) {
+    if (!zone->supports_compression()) continue;
+    total += static_cast<size_t>(zone->allocation_size());
+  }
+  return total;
+}
+
+size_t ZoneStats::GetTotalCompressedAllocatedBytes() const {
+  return total_deleted_compressed_bytes_ + GetCurrentCompressedAllocatedBytes();
+}
+
 Zone* ZoneStats::NewEmptyZone(const char* zone_name,
                               bool support_zone_compression) {
   Zone* zone = new Zone(allocator_, zone_name, support_zone_compression);
@@ -106,6 +129,10 @@ void ZoneStats::ReturnZone(Zone* zone) {
   DCHECK(it != zones_.end());
   zones_.erase(it);
   total_deleted_bytes_ += static_cast<size_t>(zone->allocation_size());
+  if (zone->supports_compression()) {
+    total_deleted_compressed_bytes_ +=
+        static_cast<size_t>(zone->allocation_size());
+  }
   delete zone;
 }
 
@@ -61,6 +61,9 @@ class V8_EXPORT_PRIVATE ZoneStats final {
     size_t GetMaxAllocatedBytes();
     size_t GetCurrentAllocatedBytes();
     size_t GetTotalAllocatedBytes();
+    // The part of the total that was allocated in zones supporting pointer
+    // compression.
+    size_t GetTotalCompressedAllocatedBytes();
 
    private:
     friend class ZoneStats;
@@ -71,6 +74,7 @@ class V8_EXPORT_PRIVATE ZoneStats final {
     ZoneStats* const zone_stats_;
     InitialValues initial_values_;
     size_t total_allocated_bytes_at_start_;
+    size_t total_compressed_allocated_bytes_at_start_;
     size_t max_allocated_bytes_;
   };
 
@@ -82,6 +86,8 @@ class V8_EXPORT_PRIVATE ZoneStats final {
   size_t GetMaxAllocatedBytes() const;
   size_t GetTotalAllocatedBytes() const;
   size_t GetCurrentAllocatedBytes() const;
+  size_t GetTotalCompressedAllocatedBytes() const;
+  size_t GetCurrentCompressedAllocatedBytes() const;
 
  private:
   Zone* NewEmptyZone(const char* zone_name, bool support_zone_compression);
@@ -95,6 +101,7 @@ class V8_EXPORT_PRIVATE ZoneStats final {
   Stats stats_;
   size_t max_allocated_bytes_;
   size_t total_deleted_bytes_;
+  size_t total_deleted_compressed_bytes_;
   AccountingAllocator* allocator_;
 };
 
@@ -905,6 +905,7 @@ void Deoptimizer::DoComputeOutputFrames() {
         DoComputeConstructStubFrame(translated_frame, frame_index);
         break;
       case TranslatedFrame::kBuiltinContinuation:
+      case TranslatedFrame::kJSToWasmBuiltinContinuation:
         DoComputeBuiltinContinuation(translated_frame, frame_index,
                                      BuiltinContinuationMode::STUB);
         break;
@@ -1624,6 +1625,31 @@ Builtins::Name Deoptimizer::TrampolineForBuiltinContinuation(
   UNREACHABLE();
 }
 
+TranslatedValue Deoptimizer::TranslatedValueForWasmReturnKind(
+    wasm::ValueType::Kind return_kind) {
+  switch (return_kind) {
+    case wasm::ValueType::kStmt:
+      return TranslatedValue::NewTagged(
+          &translated_state_, ReadOnlyRoots(isolate()).undefined_value());
+    case wasm::ValueType::kI32:
+      return TranslatedValue::NewInt32(
+          &translated_state_,
+          static_cast<int32_t>(input_->GetRegister(kReturnRegister0.code())));
+    case wasm::ValueType::kF32:
+      return TranslatedValue::NewFloat(
+          &translated_state_,
+          Float32::FromBits(static_cast<uint32_t>(
+              input_->GetDoubleRegister(kFPReturnRegister0.code())
+                  .get_bits())));
+    case wasm::ValueType::kF64:
+      return TranslatedValue::NewDouble(
+          &translated_state_,
+          input_->GetDoubleRegister(kFPReturnRegister0.code()));
+    default:
+      UNREACHABLE();
+  }
+}
+
 // BuiltinContinuationFrames capture the machine state that is expected as input
 // to a builtin, including both input register values and stack parameters. When
 // the frame is reactivated (i.e. the frame below it returns), a
@@ -1685,6 +1711,18 @@ Builtins::Name Deoptimizer::TrampolineForBuiltinContinuation(
 void Deoptimizer::DoComputeBuiltinContinuation(
     TranslatedFrame* translated_frame, int frame_index,
     BuiltinContinuationMode mode) {
+  // The result of a JS to Wasm call is an untagged Wasm value, so unlike for
+  // other lazy deopts it cannot be passed on to the continuation in the return
+  // register. Translate it from the input frame instead and append it to the
+  // frame's values, behind the register parameters and the context.
+  const bool is_js_to_wasm_builtin_continuation =
+      translated_frame->kind() == TranslatedFrame::kJSToWasmBuiltinContinuation;
+  if (is_js_to_wasm_builtin_continuation) {
+    CHECK_EQ(DeoptimizeKind::kLazy, deopt_kind_);
+    translated_frame->Add(TranslatedValueForWasmReturnKind(
+        translated_frame->wasm_call_return_kind()));
+  }
+
   TranslatedFrame::iterator value_iterator = translated_frame->begin();
 
   const BailoutId bailout_id = translated_frame->node_id();
@@ -1767,7 +1805,14 @@ void Deoptimizer::DoComputeBuiltinContinuation(
          ++i, ++value_iterator) {
       frame_writer.PushTranslatedValue(value_iterator, "stack parameter");
     }
-    if (frame_info.frame_has_result_stack_slot()) {
+    if (is_js_to_wasm_builtin_continuation) {
+      TranslatedFrame::iterator result_iterator = value_iterator;
+      for (int i = 0; i < register_parameter_count + 1; ++i) {
+        ++result_iterator;  // Skip the register parameters and the context.
+      }
+      frame_writer.PushTranslatedValue(result_iterator,
+                                       "return result of the Wasm call\n");
+    } else if (frame_info.frame_has_result_stack_slot()) {
       frame_writer.PushRawObject(
           roots.the_hole_value(),
           "placeholder for return result on lazy deopt\n");
@@ -1908,8 +1953,10 @@ void Deoptimizer::DoComputeBuiltinContinuation(
       frame_writer.PushRawObject(roots.the_hole_value(), "padding\n");
     }
 
-    // Ensure the result is restored back when we return to the stub.
-    if (frame_info.frame_has_result_stack_slot()) {
+    // Ensure the result is restored back when we return to the stub. The
+    // result of a Wasm call has already been put into the frame above.
+    if (frame_info.frame_has_result_stack_slot() &&
+        !is_js_to_wasm_builtin_continuation) {
       Register result_reg = kReturnRegister0;
       frame_writer.PushRawValue(input_->GetRegister(result_reg.code()),
                                 "callback result\n");
@@ -1918,6 +1965,7 @@ void Deoptimizer::DoComputeBuiltinContinuation(
     }
   }
 
+  if (is_js_to_wasm_builtin_continuation) ++value_iterator;
   CHECK_EQ(translated_frame->end(), value_iterator);
   CHECK_EQ(0u, frame_writer.top_offset());
 
@@ -1937,7 +1985,8 @@ void Deoptimizer::DoComputeBuiltinContinuation(
 
   Code continue_to_builtin =
       isolate()->builtins()->builtin(TrampolineForBuiltinContinuation(
-          mode, frame_info.frame_has_result_stack_slot()));
+          mode, frame_info.frame_has_result_stack_slot() &&
+                    !is_js_to_wasm_builtin_continuation));
   if (is_topmost) {
     // Only the pc of the topmost frame needs to be signed since it is
     // authenticated at the end of the DeoptimizationEntry builtin.
@@ -1957,6 +2006,16 @@ void Deoptimizer::DoComputeBuiltinContinuation(
 }
 
 void Deoptimizer::MaterializeHeapObjects() {
+  // Keep per-function statistics for eager and soft deopts; lazy deopts are
+  // caused by invalidated dependencies rather than failed speculation. This
+  // happens before materialization, which may allocate.
+  if (deopt_kind_ != DeoptimizeKind::kLazy && function_.IsJSFunction() &&
+      function_.has_feedback_vector()) {
+    FeedbackVector vector = function_.feedback_vector();
+    vector.RecordDeoptimization(
+        Deoptimizer::GetDeoptInfo(compiled_code_, from_).deopt_reason);
+  }
+
   translated_state_.Prepare(static_cast<Address>(stack_fp_));
   if (FLAG_deopt_every_n_times > 0) {
     // Doing a GC here will find problems with the deoptimized frames.
@@ -1982,7 +2041,8 @@ void Deoptimizer::MaterializeHeapObjects() {
 
   translated_state_.VerifyMaterializedObjects();
 
-  bool feedback_updated = translated_state_.DoUpdateFeedback();
+  bool feedback_updated =
+      translated_state_.DoUpdateFeedback(deopt_kind_ == DeoptimizeKind::kEager);
   if (verbose_tracing_enabled() && feedback_updated) {
     FILE* file = trace_scope()->file();
     Deoptimizer::DeoptInfo info =
@@ -2141,6 +2201,16 @@ void Translation::BeginJavaScriptBuiltinContinuationWithCatchFrame(
   buffer_->Add(height);
 }
 
+void Translation::BeginJSToWasmBuiltinContinuationFrame(
+    BailoutId bailout_id, int literal_id, unsigned height,
+    wasm::ValueType::Kind return_kind) {
+  buffer_->Add(JS_TO_WASM_BUILTIN_CONTINUATION_FRAME);
+  buffer_->Add(bailout_id.ToInt());
+  buffer_->Add(literal_id);
+  buffer_->Add(height);
+  buffer_->Add(return_kind);
+}
+
 void Translation::BeginConstructStubFrame(BailoutId bailout_id, int literal_id,
                                           unsigned height) {
   buffer_->Add(CONSTRUCT_STUB_FRAME);
@@ -2303,6 +2373,8 @@ int Translation::NumberOfOperandsFor(Opcode opcode) {
     case JAVA_SCRIPT_BUILTIN_CONTINUATION_FRAME:
     case JAVA_SCRIPT_BUILTIN_CONTINUATION_WITH_CATCH_FRAME:
       return 3;
+    case JS_TO_WASM_BUILTIN_CONTINUATION_FRAME:
+      return 4;
     case INTERPRETED_FRAME:
       return 5;
   }
@@ -2866,6 +2938,15 @@ TranslatedFrame TranslatedFrame::JavaScriptBuiltinContinuationWithCatchFrame(
   return frame;
 }
 
+TranslatedFrame TranslatedFrame::JSToWasmBuiltinContinuationFrame(
+    BailoutId bailout_id, SharedFunctionInfo shared_info, int height,
+    wasm::ValueType::Kind return_kind) {
+  TranslatedFrame frame(kJSToWasmBuiltinContinuation, shared_info, height);
+  frame.node_id_ = bailout_id;
+  frame.wasm_call_return_kind_ = return_kind;
+  return frame;
+}
+
 int TranslatedFrame::GetValueCount() {
   // The function is added to all frame state descriptors in
   // InstructionSelector::AddInputsToFrameStateDescriptor.
@@ -2886,6 +2967,7 @@ int TranslatedFrame::GetValueCount() {
 
     case kConstructStub:
     case kBuiltinContinuation:
+    case kJSToWasmBuiltinContinuation:
     case kJavaScriptBuiltinContinuation:
     case kJavaScriptBuiltinContinuationWithCatch: {
       static constexpr int kTheContext = 1;
@@ -3011,6 +3093,25 @@ TranslatedFrame TranslatedState::CreateNextTranslatedFrame(
       return TranslatedFrame::JavaScriptBuiltinContinuationWithCatchFrame(
           bailout_id, shared_info, height);
     }
+
+    case Translation::JS_TO_WASM_BUILTIN_CONTINUATION_FRAME: {
+      BailoutId bailout_id = BailoutId(iterator->Next());
+      SharedFunctionInfo shared_info =
+          SharedFunctionInfo::cast(literal_array.get(iterator->Next()));
+      int height = iterator->Next();
+      wasm::ValueType::Kind return_kind =
+          static_cast<wasm::ValueType::Kind>(iterator->Next());
+      if (trace_file != nullptr) {
+        std::unique_ptr<char[]> name = shared_info.DebugName().ToCString();
+        PrintF(trace_file, "  reading JS to Wasm builtin continuation frame %s",
+               name.get());
+        PrintF(trace_file,
+               " => bailout_id=%d, height=%d, return_kind=%d; inputs:\n",
+               bailout_id.ToInt(), height, static_cast<int>(return_kind));
+      }
+      return TranslatedFrame::JSToWasmBuiltinContinuationFrame(
+          bailout_id, shared_info, height, return_kind);
+    }
     case Translation::UPDATE_FEEDBACK:
     case Translation::BEGIN:
     case Translation::DUPLICATED_OBJECT:
@@ -3168,6 +3269,7 @@ int TranslatedState::CreateNextTranslatedValue(
     case Translation::CONSTRUCT_STUB_FRAME:
     case Translation::JAVA_SCRIPT_BUILTIN_CONTINUATION_FRAME:
     case Translation::JAVA_SCRIPT_BUILTIN_CONTINUATION_WITH_CATCH_FRAME:
+    case Translation::JS_TO_WASM_BUILTIN_CONTINUATION_FRAME:
     case Translation::BUILTIN_CONTINUATION_FRAME:
     case Translation::UPDATE_FEEDBACK:
       // Peeled off before getting here.
@@ -4277,15 +4379,42 @@ void TranslatedState::VerifyMaterializedObjects() {
 #endif
 }
 
-bool TranslatedState::DoUpdateFeedback() {
-  if (!feedback_vector_handle_.is_null()) {
-    CHECK(!feedback_slot_.IsInvalid());
+bool TranslatedState::DoUpdateFeedback(bool is_eager) {
+  if (feedback_vector_handle_.is_null()) return false;
+  CHECK(!feedback_slot_.IsInvalid());
+  FeedbackNexus nexus(feedback_vector_handle_, feedback_slot_);
+  FeedbackSlotKind kind = nexus.kind();
+  if (IsCallICKind(kind)) {
     isolate()->CountUsage(v8::Isolate::kDeoptimizerDisableSpeculation);
-    FeedbackNexus nexus(feedback_vector_handle_, feedback_slot_);
     nexus.SetSpeculationMode(SpeculationMode::kDisallowSpeculation);
     return true;
   }
-  return false;
+  // BigInt operations only deoptimize when the result is too big to be
+  // computed without throwing or without blocking interrupts. The interpreter
+  // doesn't record anything new for that case, so widen the feedback here to
+  // keep the next compilation from speculating again.
+  if (kind == FeedbackSlotKind::kBinaryOp) {
+    nexus.ConfigureBinaryOperationAny();
+    return true;
+  }
+  // A single failed map or bounds check usually only means that the IC had
+  // not seen all cases yet, and the interpreter will extend the feedback. Only
+  // once the same site keeps deoptimizing do we give up on it, so that the
+  // next compilation emits a generic access just there.
+  bool is_keyed = IsKeyedLoadICKind(kind) || IsKeyedStoreICKind(kind) ||
+                  IsKeyedHasICKind(kind);
+  if (!is_keyed && !IsLoadICKind(kind) && !IsStoreICKind(kind) &&
+      !IsStoreOwnICKind(kind)) {
+    return false;
+  }
+  if (!is_eager) return false;
+  if (FeedbackVector::RecordAccessDeopt(isolate(), feedback_vector_handle_,
+                                        feedback_slot_) <
+      FLAG_deopt_loop_threshold) {
+    return false;
+  }
+  return is_keyed ? nexus.ConfigureMegamorphic(nexus.GetKeyType())
+                  : nexus.ConfigureMegamorphic();
 }
 
 void TranslatedState::ReadUpdateFeedback(TranslationIterator* iterator,
@@ -24,6 +24,7 @@
 #include "src/objects/shared-function-info.h"
 #include "src/utils/allocation.h"
 #include "src/utils/boxed-float.h"
+#include "src/wasm/value-type.h"
 #include "src/zone/zone-chunk-list.h"
 
 namespace v8 {
@@ -62,6 +63,7 @@ class TranslatedValue {
  private:
   friend class TranslatedState;
   friend class TranslatedFrame;
+  friend class Deoptimizer;
 
   enum Kind : uint8_t {
     kInvalid,
@@ -173,6 +175,7 @@ class TranslatedFrame {
     kBuiltinContinuation,
     kJavaScriptBuiltinContinuation,
     kJavaScriptBuiltinContinuationWithCatch,
+    kJSToWasmBuiltinContinuation,
     kInvalid
   };
 
@@ -192,6 +195,13 @@ class TranslatedFrame {
   int return_value_offset() const { return return_value_offset_; }
   int return_value_count() const { return return_value_count_; }
 
+  // The kind of the value returned by the Wasm call of a
+  // kJSToWasmBuiltinContinuation frame, or kStmt for calls without result.
+  wasm::ValueType::Kind wasm_call_return_kind() const {
+    DCHECK_EQ(kind(), kJSToWasmBuiltinContinuation);
+    return wasm_call_return_kind_;
+  }
+
   SharedFunctionInfo raw_shared_info() const {
     CHECK(!raw_shared_info_.is_null());
     return raw_shared_info_;
@@ -247,6 +257,7 @@ class TranslatedFrame {
 
  private:
   friend class TranslatedState;
+  friend class Deoptimizer;
 
   // Constructor static methods.
   static TranslatedFrame InterpretedFrame(BailoutId bytecode_offset,
@@ -266,6 +277,9 @@ class TranslatedFrame {
       BailoutId bailout_id, SharedFunctionInfo shared_info, int height);
   static TranslatedFrame JavaScriptBuiltinContinuationWithCatchFrame(
       BailoutId bailout_id, SharedFunctionInfo shared_info, int height);
+  static TranslatedFrame JSToWasmBuiltinContinuationFrame(
+      BailoutId bailout_id, SharedFunctionInfo shared_info, int height,
+      wasm::ValueType::Kind return_kind);
   static TranslatedFrame InvalidFrame() {
     return TranslatedFrame(kInvalid, SharedFunctionInfo());
   }
@@ -294,6 +308,7 @@ class TranslatedFrame {
   int height_;
   int return_value_offset_;
   int return_value_count_;
+  wasm::ValueType::Kind wasm_call_return_kind_ = wasm::ValueType::kStmt;
 
   using ValuesContainer = std::deque<TranslatedValue>;
 
@@ -347,7 +362,10 @@ class TranslatedState {
             FILE* trace_file, int parameter_count, int actual_argument_count);
 
   void VerifyMaterializedObjects();
-  bool DoUpdateFeedback();
+  // Updates the feedback slot recorded for the deopt point, if any. Call sites
+  // always stop speculating; property access sites become megamorphic once
+  // they have failed {FLAG_deopt_loop_threshold} eager checks before.
+  bool DoUpdateFeedback(bool is_eager);
 
  private:
   friend TranslatedValue;
@@ -568,6 +586,9 @@ class Deoptimizer : public Malloced {
   static Builtins::Name TrampolineForBuiltinContinuation(
       BuiltinContinuationMode mode, bool must_handle_result);
 
+  TranslatedValue TranslatedValueForWasmReturnKind(
+      wasm::ValueType::Kind return_kind);
+
   void DoComputeBuiltinContinuation(TranslatedFrame* translated_frame,
                                     int frame_index,
                                     BuiltinContinuationMode mode);
@@ -866,6 +887,7 @@ class TranslationIterator {
   V(BUILTIN_CONTINUATION_FRAME)                        \
   V(JAVA_SCRIPT_BUILTIN_CONTINUATION_FRAME)            \
   V(JAVA_SCRIPT_BUILTIN_CONTINUATION_WITH_CATCH_FRAME) \
+  V(JS_TO_WASM_BUILTIN_CONTINUATION_FRAME)             \
   V(CONSTRUCT_STUB_FRAME)                              \
   V(ARGUMENTS_ADAPTOR_FRAME)                           \
   V(DUPLICATED_OBJECT)                                 \
@@ -922,6 +944,9 @@ class Translation {
   void BeginJavaScriptBuiltinContinuationWithCatchFrame(BailoutId bailout_id,
                                                         int literal_id,
                                                         unsigned height);
+  void BeginJSToWasmBuiltinContinuationFrame(BailoutId bailout_id,
+                                             int literal_id, unsigned height,
+                                             wasm::ValueType::Kind return_kind);
   void ArgumentsElements(CreateArgumentsType type);
   void ArgumentsLength();
   void BeginCapturedObject(int length);
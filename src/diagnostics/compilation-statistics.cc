@@ -48,6 +48,7 @@ void CompilationStatistics::RecordTotalStats(const BasicStats& stats) {
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
+  total_compressed_allocated_bytes_ += stats.total_compressed_allocated_bytes_;
   if (stats.absolute_max_allocated_bytes_ > absolute_max_allocated_bytes_) {
     absolute_max_allocated_bytes_ = stats.absolute_max_allocated_bytes_;
     max_allocated_bytes_ = stats.max_allocated_bytes_;
@@ -71,6 +72,11 @@ static void WriteLine(std::ostream& os, bool machine_format, const char* name,
                        "\"%s_time\"=%.3f\n\"%s_space\"=%zu", name, ms, name,
                        stats.total_allocated_bytes_);
     os << buffer;
+    if (stats.total_compressed_allocated_bytes_ > 0) {
+      base::OS::SNPrintF(buffer, kBufferSize, "\n\"%s_compressed_space\"=%zu",
+                         name, stats.total_compressed_allocated_bytes_);
+      os << buffer;
+    }
   } else {
     base::OS::SNPrintF(buffer, kBufferSize,
                        "%34s %10.3f (%5.1f%%)  %10zu (%5.1f%%) %10zu %10zu",
@@ -146,6 +152,15 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
 
   if (!ps.machine_output) WriteFullLine(os);
   WriteLine(os, ps.machine_output, "totals", s.total_stats_, s.total_stats_);
+  if (!ps.machine_output &&
+      s.total_stats_.total_compressed_allocated_bytes_ > 0) {
+    const size_t kBufferSize = 128;
+    char buffer[kBufferSize];
+    base::OS::SNPrintF(buffer, kBufferSize, "%34s %21s%10zu",
+                       "in compressed zones", "",
+                       s.total_stats_.total_compressed_allocated_bytes_);
+    os << buffer << std::endl;
+  }
 
   return os;
 }
@@ -30,6 +30,7 @@ class CompilationStatistics final : public Malloced {
    public:
     BasicStats()
         : total_allocated_bytes_(0),
+          total_compressed_allocated_bytes_(0),
           max_allocated_bytes_(0),
           absolute_max_allocated_bytes_(0) {}
 
@@ -37,6 +38,8 @@ class CompilationStatistics final : public Malloced {
 
     base::TimeDelta delta_;
     size_t total_allocated_bytes_;
+    // Part of {total_allocated_bytes_} in zones with compressed pointers.
+    size_t total_compressed_allocated_bytes_;
     size_t max_allocated_bytes_;
     size_t absolute_max_allocated_bytes_;
     std::string function_name_;
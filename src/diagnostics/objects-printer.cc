@@ -895,8 +895,15 @@ void FeedbackVector::FeedbackVectorPrint(std::ostream& os) {  // NOLINT
   }
   os << "\n - optimization marker: " << optimization_marker();
   os << "\n - optimization tier: " << optimization_tier();
+  os << "\n - deopt count: " << deopt_count();
+  if (deopt_count() > 0) {
+    os << "\n - last deopt reason: " << last_deopt_reason();
+  }
   os << "\n - invocation count: " << invocation_count();
   os << "\n - profiler ticks: " << profiler_ticks();
+  if (access_deopt_counts().IsByteArray()) {
+    os << "\n - access deopt counts: " << Brief(access_deopt_counts());
+  }
 
   FeedbackMetadataIterator iter(metadata());
   while (iter.HasNext()) {
@@ -26,6 +26,7 @@
 #include "src/builtins/constants-table-builder.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
+#include "src/codegen/feedback-profile.h"
 #include "src/codegen/flush-instruction-cache.h"
 #include "src/common/assert-scope.h"
 #include "src/common/ptr-compr.h"
@@ -3778,6 +3779,13 @@ std::unique_ptr<PersistentHandles> Isolate::NewPersistentHandles() {
   return std::make_unique<PersistentHandles>(this);
 }
 
+FeedbackProfileTable* Isolate::EnsureFeedbackProfileTable() {
+  if (!feedback_profile_table_) {
+    feedback_profile_table_ = std::make_unique<FeedbackProfileTable>();
+  }
+  return feedback_profile_table_.get();
+}
+
 void Isolate::DumpAndResetStats() {
   if (FLAG_trace_turbo_stack_accesses) {
     StdoutStream os;
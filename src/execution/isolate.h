@@ -81,6 +81,7 @@ class Deoptimizer;
 class DescriptorLookupCache;
 class EmbeddedFileWriterInterface;
 class EternalHandles;
+class FeedbackProfileTable;
 class HandleScopeImplementer;
 class HeapObjectToIndexHashMap;
 class HeapProfiler;
@@ -979,6 +980,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   }
   RuntimeProfiler* runtime_profiler() { return runtime_profiler_; }
   CompilationCache* compilation_cache() { return compilation_cache_; }
+  FeedbackProfileTable* feedback_profile_table() {
+    return feedback_profile_table_.get();
+  }
+  FeedbackProfileTable* EnsureFeedbackProfileTable();
   Logger* logger() {
     // Call InitializeLoggingAndCounters() if logging is needed before
     // the isolate is fully initialized.
@@ -1893,6 +1898,9 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   std::unique_ptr<PersistentHandlesList> persistent_handles_list_;
 
+  // Entries of preloaded feedback profiles, see FeedbackProfile::Preload.
+  std::unique_ptr<FeedbackProfileTable> feedback_profile_table_;
+
   // Counts deopt points if deopt_every_n_times is enabled.
   unsigned int stress_deopt_count_ = 0;
 
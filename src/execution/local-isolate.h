@@ -81,6 +81,10 @@ class V8_EXPORT_PRIVATE LocalIsolate final : private HiddenLocalFactory {
   ThreadId thread_id() const { return thread_id_; }
   Address stack_limit() const { return stack_limit_; }
 
+  // The main thread's Isolate. Only use it for state that is immutable or
+  // otherwise safe to read from a background thread.
+  Isolate* GetMainThreadIsolateUnsafe() const { return isolate_; }
+
  private:
   friend class v8::internal::LocalFactory;
 
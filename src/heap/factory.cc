@@ -430,7 +430,9 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
   vector->set_invocation_count(0);
   vector->set_profiler_ticks(0);
   vector->InitializeOptimizationState();
+  vector->clear_padding();
   vector->set_closure_feedback_cell_array(*closure_feedback_cell_array);
+  vector->set_access_deopt_counts(*undefined_value(), SKIP_WRITE_BARRIER);
 
   // TODO(leszeks): Initialize based on the feedback metadata.
   MemsetTagged(ObjectSlot(vector->slots_start()), *undefined_value(), length);
@@ -91,6 +91,8 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/wasm/wasm-engine.h"
+#include "src/zone/accounting-allocator.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor.h"
@@ -3726,6 +3728,12 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                static_cast<int>(level));
   MemoryPressureLevel previous =
       memory_pressure_level_.exchange(level, std::memory_order_relaxed);
+  if (level != MemoryPressureLevel::kNone) {
+    // Zone segments cached for reuse can be dropped right away from any
+    // thread.
+    isolate()->allocator()->ReleaseCachedSegments();
+    isolate()->wasm_engine()->allocator()->ReleaseCachedSegments();
+  }
   if ((previous != MemoryPressureLevel::kCritical &&
        level == MemoryPressureLevel::kCritical) ||
       (previous == MemoryPressureLevel::kNone &&
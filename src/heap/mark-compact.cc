@@ -2073,6 +2073,7 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_FLUSHED_JS_FUNCTIONS);
     ClearFlushedJsFunctions();
+    ClearFlushedFeedbackCells();
   }
 
   {
@@ -2105,6 +2106,7 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   DCHECK(weak_objects_.weak_cells.IsEmpty());
   DCHECK(weak_objects_.bytecode_flushing_candidates.IsEmpty());
   DCHECK(weak_objects_.flushed_js_functions.IsEmpty());
+  DCHECK(weak_objects_.flushed_feedback_cells.IsEmpty());
 }
 
 void MarkCompactCollector::MarkDependentCodeForDeoptimization() {
@@ -2224,13 +2226,17 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
 void MarkCompactCollector::ClearOldBytecodeCandidates() {
   DCHECK(FLAG_flush_bytecode ||
          weak_objects_.bytecode_flushing_candidates.IsEmpty());
+  int flushed_functions = 0;
+  int flushed_size = 0;
   SharedFunctionInfo flushing_candidate;
   while (weak_objects_.bytecode_flushing_candidates.Pop(kMainThreadTask,
                                                         &flushing_candidate)) {
     // If the BytecodeArray is dead, flush it, which will replace the field with
     // an uncompiled data object.
-    if (!non_atomic_marking_state()->IsBlackOrGrey(
-            flushing_candidate.GetBytecodeArray())) {
+    BytecodeArray bytecode = flushing_candidate.GetBytecodeArray();
+    if (!non_atomic_marking_state()->IsBlackOrGrey(bytecode)) {
+      flushed_functions++;
+      flushed_size += bytecode.Size();
       FlushBytecodeFromSFI(flushing_candidate);
     }
 
@@ -2240,6 +2246,15 @@ void MarkCompactCollector::ClearOldBytecodeCandidates() {
         flushing_candidate.RawField(SharedFunctionInfo::kFunctionDataOffset);
     RecordSlot(flushing_candidate, slot, HeapObject::cast(*slot));
   }
+
+  if (flushed_functions == 0) return;
+  isolate()->counters()->flushed_bytecode_functions()->Increment(
+      flushed_functions);
+  isolate()->counters()->flushed_bytecode_size()->Increment(flushed_size);
+  if (FLAG_trace_flush_bytecode) {
+    PrintIsolate(isolate(), "Flushed bytecode of %d functions (%d bytes)\n",
+                 flushed_functions, flushed_size);
+  }
 }
 
 void MarkCompactCollector::ClearFlushedJsFunctions() {
@@ -2255,6 +2270,22 @@ void MarkCompactCollector::ClearFlushedJsFunctions() {
   }
 }
 
+void MarkCompactCollector::ClearFlushedFeedbackCells() {
+  DCHECK(FLAG_flush_bytecode ||
+         weak_objects_.flushed_feedback_cells.IsEmpty());
+  FeedbackCell flushed_feedback_cell;
+  while (weak_objects_.flushed_feedback_cells.Pop(kMainThreadTask,
+                                                  &flushed_feedback_cell)) {
+    // The function may have been compiled again since the cell was visited.
+    if (!flushed_feedback_cell.NeedsResetDueToFlushedBytecode()) continue;
+    auto gc_notify_updated_slot = [](HeapObject object, ObjectSlot slot,
+                                     Object target) {
+      RecordSlot(object, slot, HeapObject::cast(target));
+    };
+    flushed_feedback_cell.reset_feedback_vector(gc_notify_updated_slot);
+  }
+}
+
 void MarkCompactCollector::ClearFullMapTransitions() {
   TransitionArray array;
   while (weak_objects_.transition_arrays.Pop(kMainThreadTask, &array)) {
@@ -2550,6 +2581,7 @@ void MarkCompactCollector::AbortWeakObjects() {
   weak_objects_.weak_cells.Clear();
   weak_objects_.bytecode_flushing_candidates.Clear();
   weak_objects_.flushed_js_functions.Clear();
+  weak_objects_.flushed_feedback_cells.Clear();
 }
 
 bool MarkCompactCollector::IsOnEvacuationCandidate(MaybeObject obj) {
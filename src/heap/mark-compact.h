@@ -674,6 +674,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   // Resets any JSFunctions which have had their bytecode flushed.
   void ClearFlushedJsFunctions();
 
+  // Resets feedback cells that still hold the feedback vector of a function
+  // whose bytecode has been flushed.
+  void ClearFlushedFeedbackCells();
+
   // Compact every array in the global list of transition arrays and
   // trim the corresponding descriptor array if a transition target is non-live.
   void ClearFullMapTransitions();
@@ -138,6 +138,25 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitJSFunction(
   return size;
 }
 
+template <typename ConcreteVisitor, typename MarkingState>
+int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitFeedbackCell(
+    Map map, FeedbackCell object) {
+  if (!concrete_visitor()->ShouldVisit(object)) return 0;
+
+  int size = FeedbackCell::BodyDescriptor::SizeOf(map, object);
+  this->VisitMapPointer(object);
+  FeedbackCell::BodyDescriptor::IterateBody(map, object, size, this);
+
+  // A feedback vector can outlive all closures of its function. Reset it once
+  // the function's bytecode has been flushed, rather than waiting for a
+  // JSFunction to do so.
+  if (bytecode_flush_mode_ != BytecodeFlushMode::kDoNotFlushBytecode &&
+      object.NeedsResetDueToFlushedBytecode()) {
+    weak_objects_->flushed_feedback_cells.Push(task_id_, object);
+  }
+  return size;
+}
+
 template <typename ConcreteVisitor, typename MarkingState>
 int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitSharedFunctionInfo(
     Map map, SharedFunctionInfo shared_info) {
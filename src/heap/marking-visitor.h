@@ -119,6 +119,7 @@ class MarkingVisitorBase : public HeapVisitor<int, ConcreteVisitor> {
   V8_INLINE int VisitBytecodeArray(Map map, BytecodeArray object);
   V8_INLINE int VisitDescriptorArray(Map map, DescriptorArray object);
   V8_INLINE int VisitEphemeronHashTable(Map map, EphemeronHashTable object);
+  V8_INLINE int VisitFeedbackCell(Map map, FeedbackCell object);
   V8_INLINE int VisitFixedArray(Map map, FixedArray object);
   V8_INLINE int VisitFixedDoubleArray(Map map, FixedDoubleArray object);
   V8_INLINE int VisitJSApiObject(Map map, JSObject object);
@@ -155,6 +155,21 @@ void WeakObjects::UpdateFlushedJSFunctions(
       });
 }
 
+void WeakObjects::UpdateFlushedFeedbackCells(
+    WeakObjectWorklist<FeedbackCell>& flushed_feedback_cells) {
+  flushed_feedback_cells.Update(
+      [](FeedbackCell slot_in, FeedbackCell* slot_out) -> bool {
+        FeedbackCell forwarded = ForwardingAddress(slot_in);
+
+        if (!forwarded.is_null()) {
+          *slot_out = forwarded;
+          return true;
+        }
+
+        return false;
+      });
+}
+
 #ifdef DEBUG
 template <typename Type>
 bool WeakObjects::ContainsYoungObjects(WeakObjectWorklist<Type>& worklist) {
@@ -59,7 +59,8 @@ class TransitionArray;
   F(WeakCell, weak_cells, WeakCells)                                         \
   F(SharedFunctionInfo, bytecode_flushing_candidates,                        \
     BytecodeFlushingCandidates)                                              \
-  F(JSFunction, flushed_js_functions, FlushedJSFunctions)
+  F(JSFunction, flushed_js_functions, FlushedJSFunctions)                    \
+  F(FeedbackCell, flushed_feedback_cells, FlushedFeedbackCells)
 
 class WeakObjects {
  public:
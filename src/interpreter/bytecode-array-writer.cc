@@ -33,6 +33,7 @@ BytecodeArrayWriter::BytecodeArrayWriter(
       last_bytecode_offset_(0),
       last_bytecode_had_source_info_(false),
       elide_noneffectful_bytecodes_(FLAG_ignition_elide_noneffectful_bytecodes),
+      emit_short_star_(FLAG_ignition_short_star),
       exit_seen_in_block_(false) {
   bytecodes_.reserve(512);  // Derived via experimentation.
 }
@@ -276,6 +277,17 @@ void BytecodeArrayWriter::EmitBytecode(const BytecodeNode* const node) {
   Bytecode bytecode = node->bytecode();
   OperandScale operand_scale = node->operand_scale();
 
+  if (bytecode == Bytecode::kStar && emit_short_star_) {
+    // Stores to the first registers use the operand-less short form.
+    Register reg =
+        Register::FromOperand(static_cast<int32_t>(node->operand(0)));
+    if (reg.HasShortStar()) {
+      DCHECK_EQ(operand_scale, OperandScale::kSingle);
+      bytecodes()->push_back(Bytecodes::ToByte(reg.ToShortStar()));
+      return;
+    }
+  }
+
   if (operand_scale != OperandScale::kSingle) {
     Bytecode prefix = Bytecodes::OperandScaleToPrefixBytecode(operand_scale);
     bytecodes()->push_back(Bytecodes::ToByte(prefix));
@@ -53,6 +53,24 @@ class V8_EXPORT_PRIVATE Register final {
   // bytecode.
   static Register virtual_accumulator();
 
+  // Returns the register that the short-form Star |bytecode| stores to.
+  static Register FromShortStar(Bytecode bytecode) {
+    DCHECK(Bytecodes::IsShortStar(bytecode));
+    return Register(static_cast<int>(bytecode) -
+                    static_cast<int>(Bytecode::kStar0));
+  }
+
+  // Returns true if a short-form Star bytecode can store to this register.
+  bool HasShortStar() const {
+    return index_ >= 0 && index_ < Bytecodes::kShortStarCount;
+  }
+
+  // Returns the short-form Star bytecode that stores to this register.
+  Bytecode ToShortStar() const {
+    DCHECK(HasShortStar());
+    return static_cast<Bytecode>(static_cast<int>(Bytecode::kStar0) + index_);
+  }
+
   OperandSize SizeOfOperand() const;
 
   int32_t ToOperand() const { return kRegisterFileStartOffset - index_; }
@@ -1137,15 +1137,19 @@ TNode<WordT> InterpreterAssembler::LoadBytecode(
 
 TNode<WordT> InterpreterAssembler::StarDispatchLookahead(
     TNode<WordT> target_bytecode) {
-  Label do_inline_star(this), done(this);
+  Label do_inline_star(this), do_inline_short_star(this), done(this);
 
   TVARIABLE(WordT, var_bytecode, target_bytecode);
 
+  TNode<Int32T> bytecode = TruncateWordToInt32(target_bytecode);
   TNode<Int32T> star_bytecode =
       Int32Constant(static_cast<int>(Bytecode::kStar));
-  TNode<BoolT> is_star =
-      Word32Equal(TruncateWordToInt32(target_bytecode), star_bytecode);
-  Branch(is_star, &do_inline_star, &done);
+  GotoIf(Word32Equal(bytecode, star_bytecode), &do_inline_star);
+  // Star0..Star15 are contiguous, so a single unsigned range check suffices.
+  TNode<BoolT> is_short_star = Uint32LessThan(
+      Int32Sub(bytecode, Int32Constant(static_cast<int>(Bytecode::kStar0))),
+      Uint32Constant(Bytecodes::kShortStarCount));
+  Branch(is_short_star, &do_inline_short_star, &done);
 
   BIND(&do_inline_star);
   {
@@ -1153,6 +1157,12 @@ TNode<WordT> InterpreterAssembler::StarDispatchLookahead(
     var_bytecode = LoadBytecode(BytecodeOffset());
     Goto(&done);
   }
+  BIND(&do_inline_short_star);
+  {
+    InlineShortStar(target_bytecode);
+    var_bytecode = LoadBytecode(BytecodeOffset());
+    Goto(&done);
+  }
   BIND(&done);
   return var_bytecode.value();
 }
@@ -1177,6 +1187,80 @@ void InterpreterAssembler::InlineStar() {
   accumulator_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
+  Bytecode previous_bytecode = bytecode_;
+  AccumulatorUse previous_acc_use = accumulator_use_;
+
+  // All short stars share the same size and accumulator use, so Star0 stands
+  // in for the dynamically selected one.
+  bytecode_ = Bytecode::kStar0;
+  accumulator_use_ = AccumulatorUse::kNone;
+
+#ifdef V8_TRACE_IGNITION
+  TraceBytecode(Runtime::kInterpreterTraceBytecodeEntry);
+#endif
+  TNode<IntPtrT> register_index =
+      IntPtrSub(Signed(target_bytecode),
+                IntPtrConstant(static_cast<int>(Bytecode::kStar0)));
+  TNode<IntPtrT> register_operand =
+      IntPtrSub(IntPtrConstant(Register(0).ToOperand()), register_index);
+  StoreRegister(GetAccumulator(), register_operand);
+
+  DCHECK_EQ(accumulator_use_, AccumulatorUse::kRead);
+
+  Advance();
+  bytecode_ = previous_bytecode;
+  accumulator_use_ = previous_acc_use;
+}
+
+void InterpreterAssembler::JumpIfBooleanDispatchLookahead(
+    TNode<WordT> target_bytecode) {
+  Label do_inline_jump_if_true(this), do_inline_jump_if_false(this),
+      done(this);
+
+  TNode<Int32T> bytecode = TruncateWordToInt32(target_bytecode);
+  GotoIf(Word32Equal(bytecode, Int32Constant(
+                                   static_cast<int>(Bytecode::kJumpIfTrue))),
+         &do_inline_jump_if_true);
+  Branch(Word32Equal(bytecode,
+                     Int32Constant(static_cast<int>(Bytecode::kJumpIfFalse))),
+         &do_inline_jump_if_false, &done);
+
+  BIND(&do_inline_jump_if_true);
+  InlineJumpIfBoolean(Bytecode::kJumpIfTrue);
+
+  BIND(&do_inline_jump_if_false);
+  InlineJumpIfBoolean(Bytecode::kJumpIfFalse);
+
+  BIND(&done);
+}
+
+void InterpreterAssembler::InlineJumpIfBoolean(Bytecode jump_bytecode) {
+  DCHECK(jump_bytecode == Bytecode::kJumpIfTrue ||
+         jump_bytecode == Bytecode::kJumpIfFalse);
+  Bytecode previous_bytecode = bytecode_;
+  AccumulatorUse previous_acc_use = accumulator_use_;
+
+  bytecode_ = jump_bytecode;
+  accumulator_use_ = AccumulatorUse::kNone;
+
+#ifdef V8_TRACE_IGNITION
+  TraceBytecode(Runtime::kInterpreterTraceBytecodeEntry);
+#endif
+  TNode<Object> accumulator = GetAccumulator();
+  TNode<IntPtrT> relative_jump = Signed(BytecodeOperandUImmWord(0));
+  CSA_ASSERT(this, IsBoolean(CAST(accumulator)));
+  TNode<Oddball> expected = jump_bytecode == Bytecode::kJumpIfTrue
+                                ? TrueConstant()
+                                : FalseConstant();
+  JumpIfTaggedEqual(accumulator, expected, relative_jump);
+
+  DCHECK_EQ(accumulator_use_, Bytecodes::GetAccumulatorUse(bytecode_));
+
+  bytecode_ = previous_bytecode;
+  accumulator_use_ = previous_acc_use;
+}
+
 void InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
@@ -1185,6 +1269,8 @@ void InterpreterAssembler::Dispatch() {
 
   if (Bytecodes::IsStarLookahead(bytecode_, operand_scale_)) {
     target_bytecode = StarDispatchLookahead(target_bytecode);
+  } else if (Bytecodes::IsJumpIfBooleanLookahead(bytecode_, operand_scale_)) {
+    JumpIfBooleanDispatchLookahead(target_bytecode);
   }
   DispatchToBytecode(target_bytecode, BytecodeOffset());
 }
@@ -375,14 +375,27 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // Load the bytecode at |bytecode_offset|.
   TNode<WordT> LoadBytecode(TNode<IntPtrT> bytecode_offset);
 
-  // Look ahead for Star and inline it in a branch. Returns a new target
-  // bytecode node for dispatch.
+  // Look ahead for Star and Star0..Star15 and inline them in a branch.
+  // Returns a new target bytecode node for dispatch.
   TNode<WordT> StarDispatchLookahead(TNode<WordT> target_bytecode);
 
   // Build code for Star at the current BytecodeOffset() and Advance() to the
   // next dispatch offset.
   void InlineStar();
 
+  // Build code for the short Star |target_bytecode| at the current
+  // BytecodeOffset() and Advance() to the next dispatch offset.
+  void InlineShortStar(TNode<WordT> target_bytecode);
+
+  // Look ahead for JumpIfTrue and JumpIfFalse and inline them in a branch.
+  // The inlined jumps dispatch themselves, so this only returns if
+  // |target_bytecode| is neither of them.
+  void JumpIfBooleanDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for |jump_bytecode| (JumpIfTrue or JumpIfFalse) at the current
+  // BytecodeOffset() and dispatch to the next bytecode.
+  void InlineJumpIfBoolean(Bytecode jump_bytecode);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
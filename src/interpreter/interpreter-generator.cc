@@ -145,6 +145,18 @@ IGNITION_HANDLER(Star, InterpreterAssembler) {
   Dispatch();
 }
 
+// Star0 .. Star15
+//
+// Store accumulator to the register encoded in the bytecode itself.
+#define SHORT_STAR_HANDLER(Name, ...)                          \
+  IGNITION_HANDLER(Name, InterpreterAssembler) {               \
+    StoreRegister(GetAccumulator(),                            \
+                  Register::FromShortStar(Bytecode::k##Name)); \
+    Dispatch();                                                \
+  }
+SHORT_STAR_BYTECODE_LIST(SHORT_STAR_HANDLER)
+#undef SHORT_STAR_HANDLER
+
 // Mov <src> <dst>
 //
 // Stores the value of register <src> to register <dst>.
@@ -32,7 +32,7 @@ namespace interpreter {
 class InterpreterCompilationJob final : public UnoptimizedCompilationJob {
  public:
   InterpreterCompilationJob(
-      ParseInfo* parse_info, FunctionLiteral* literal,
+      ParseInfo* parse_info, FunctionLiteral* literal, uintptr_t stack_limit,
       AccountingAllocator* allocator,
       std::vector<FunctionLiteral*>* eager_inner_literals);
   InterpreterCompilationJob(const InterpreterCompilationJob&) = delete;
@@ -154,11 +154,10 @@ bool ShouldPrintBytecode(Handle<SharedFunctionInfo> shared) {
 }  // namespace
 
 InterpreterCompilationJob::InterpreterCompilationJob(
-    ParseInfo* parse_info, FunctionLiteral* literal,
+    ParseInfo* parse_info, FunctionLiteral* literal, uintptr_t stack_limit,
     AccountingAllocator* allocator,
     std::vector<FunctionLiteral*>* eager_inner_literals)
-    : UnoptimizedCompilationJob(parse_info->stack_limit(), parse_info,
-                                &compilation_info_),
+    : UnoptimizedCompilationJob(stack_limit, parse_info, &compilation_info_),
       zone_(allocator, ZONE_NAME),
       compilation_info_(&zone_, parse_info, literal),
       generator_(&zone_, &compilation_info_, parse_info->ast_string_constants(),
@@ -285,16 +284,24 @@ std::unique_ptr<UnoptimizedCompilationJob> Interpreter::NewCompilationJob(
     ParseInfo* parse_info, FunctionLiteral* literal,
     AccountingAllocator* allocator,
     std::vector<FunctionLiteral*>* eager_inner_literals) {
+  return NewCompilationJob(parse_info, literal, parse_info->stack_limit(),
+                           allocator, eager_inner_literals);
+}
+
+std::unique_ptr<UnoptimizedCompilationJob> Interpreter::NewCompilationJob(
+    ParseInfo* parse_info, FunctionLiteral* literal, uintptr_t stack_limit,
+    AccountingAllocator* allocator,
+    std::vector<FunctionLiteral*>* eager_inner_literals) {
   return std::make_unique<InterpreterCompilationJob>(
-      parse_info, literal, allocator, eager_inner_literals);
+      parse_info, literal, stack_limit, allocator, eager_inner_literals);
 }
 
 std::unique_ptr<UnoptimizedCompilationJob>
 Interpreter::NewSourcePositionCollectionJob(
     ParseInfo* parse_info, FunctionLiteral* literal,
     Handle<BytecodeArray> existing_bytecode, AccountingAllocator* allocator) {
-  auto job = std::make_unique<InterpreterCompilationJob>(parse_info, literal,
-                                                         allocator, nullptr);
+  auto job = std::make_unique<InterpreterCompilationJob>(
+      parse_info, literal, parse_info->stack_limit(), allocator, nullptr);
   job->compilation_info()->SetBytecodeArray(existing_bytecode);
   return job;
 }
@@ -48,6 +48,14 @@ class Interpreter {
       AccountingAllocator* allocator,
       std::vector<FunctionLiteral*>* eager_inner_literals);
 
+  // As above, but the job checks for stack overflow against |stack_limit|
+  // rather than the limit of |parse_info|. Used when the job is executed on a
+  // different thread than the one that parsed |literal|.
+  static std::unique_ptr<UnoptimizedCompilationJob> NewCompilationJob(
+      ParseInfo* parse_info, FunctionLiteral* literal, uintptr_t stack_limit,
+      AccountingAllocator* allocator,
+      std::vector<FunctionLiteral*>* eager_inner_literals);
+
   // Creates a compilation job which will generate source positions for
   // |literal| and when finalized, store the result into |existing_bytecode|.
   static std::unique_ptr<UnoptimizedCompilationJob>
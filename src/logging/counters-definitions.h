@@ -277,6 +277,9 @@ namespace internal {
 #define STATS_COUNTER_LIST_2(SC)                                               \
   /* Amount of (JS) compiled code. */                                          \
   SC(total_compiled_code_size, V8.TotalCompiledCodeSize)                       \
+  /* Bytecode discarded by bytecode flushing. */                               \
+  SC(flushed_bytecode_functions, V8.FlushedBytecodeFunctions)                  \
+  SC(flushed_bytecode_size, V8.FlushedBytecodeSize)                            \
   SC(gc_compactor_caused_by_request, V8.GCCompactorCausedByRequest)            \
   SC(gc_compactor_caused_by_promoted_data, V8.GCCompactorCausedByPromotedData) \
   SC(gc_compactor_caused_by_oldspace_exhaustion,                               \
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <iomanip>
 
 #include "src/execution/isolate-utils.h"
@@ -526,6 +527,19 @@ void DeoptimizationData::DeoptimizationDataPrint(std::ostream& os) {  // NOLINT
           break;
         }
 
+        case Translation::JS_TO_WASM_BUILTIN_CONTINUATION_FRAME: {
+          int bailout_id = iterator.Next();
+          int shared_info_id = iterator.Next();
+          Object shared_info = LiteralArray().get(shared_info_id);
+          unsigned height = iterator.Next();
+          int return_kind = iterator.Next();
+          os << "{bailout_id=" << bailout_id << ", function="
+             << Brief(SharedFunctionInfo::cast(shared_info).DebugName())
+             << ", height=" << height << ", return_kind=" << return_kind
+             << "}";
+          break;
+        }
+
         case Translation::ARGUMENTS_ADAPTOR_FRAME: {
           int shared_info_id = iterator.Next();
           Object shared_info = LiteralArray().get(shared_info_id);
@@ -912,7 +926,10 @@ void BytecodeArray::MakeOlder() {
 }
 
 bool BytecodeArray::IsOld() const {
-  return bytecode_age() >= kIsOldBytecodeAge;
+  // The age saturates at kLastBytecodeAge, so larger thresholds are clamped.
+  int old_age = std::min(std::max(FLAG_bytecode_old_age, 1),
+                         static_cast<int>(kLastBytecodeAge));
+  return bytecode_age() >= old_age;
 }
 
 DependentCode DependentCode::GetDependentCode(Handle<HeapObject> object) {
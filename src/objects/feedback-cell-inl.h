@@ -8,6 +8,7 @@
 #include "src/objects/feedback-cell.h"
 
 #include "src/heap/heap-write-barrier-inl.h"
+#include "src/objects/feedback-vector.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/struct-inl.h"
 
@@ -45,6 +46,19 @@ void FeedbackCell::reset_feedback_vector(
   }
 }
 
+bool FeedbackCell::NeedsResetDueToFlushedBytecode() {
+  // Do raw reads here since this function may be called on a concurrent
+  // thread.
+  Object maybe_feedback_vector = RELAXED_READ_FIELD(*this, kValueOffset);
+  if (!maybe_feedback_vector.IsFeedbackVector()) return false;
+
+  Object maybe_shared =
+      RELAXED_READ_FIELD(FeedbackVector::cast(maybe_feedback_vector),
+                         FeedbackVector::kSharedFunctionInfoOffset);
+  if (!maybe_shared.IsSharedFunctionInfo()) return false;
+  return !SharedFunctionInfo::cast(maybe_shared).is_compiled();
+}
+
 void FeedbackCell::SetInitialInterruptBudget() {
   if (FLAG_lazy_feedback_allocation) {
     set_interrupt_budget(FLAG_budget_for_feedback_vector_allocation);
@@ -33,6 +33,9 @@ class FeedbackCell : public TorqueGeneratedFeedbackCell<FeedbackCell, Struct> {
       base::Optional<std::function<void(HeapObject object, ObjectSlot slot,
                                         HeapObject target)>>
           gc_notify_updated_slot = base::nullopt);
+  // Returns true if the cell still holds a feedback vector for a function
+  // whose bytecode has been flushed.
+  inline bool NeedsResetDueToFlushedBytecode();
   inline void SetInitialInterruptBudget();
   inline void SetInterruptBudget();
 
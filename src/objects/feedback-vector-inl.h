@@ -108,6 +108,13 @@ FeedbackMetadata FeedbackVector::metadata() const {
 
 void FeedbackVector::clear_invocation_count() { set_invocation_count(0); }
 
+void FeedbackVector::clear_padding() {
+  if (FIELD_SIZE(kOptionalPaddingOffset) == 0) return;
+  DCHECK_EQ(4, FIELD_SIZE(kOptionalPaddingOffset));
+  memset(reinterpret_cast<void*>(address() + kOptionalPaddingOffset), 0,
+         FIELD_SIZE(kOptionalPaddingOffset));
+}
+
 Code FeedbackVector::optimized_code() const {
   MaybeObject slot = maybe_optimized_code();
   DCHECK(slot->IsWeakOrCleared());
@@ -126,6 +133,14 @@ OptimizationMarker FeedbackVector::optimization_marker() const {
   return OptimizationMarkerBits::decode(flags());
 }
 
+int FeedbackVector::deopt_count() const {
+  return DeoptCountBits::decode(flags());
+}
+
+DeoptimizeReason FeedbackVector::last_deopt_reason() const {
+  return static_cast<DeoptimizeReason>(LastDeoptReasonBits::decode(flags()));
+}
+
 OptimizationTier FeedbackVector::optimization_tier() const {
   OptimizationTier tier = OptimizationTierBits::decode(flags());
   // It is possible that the optimization tier bits aren't updated when the code
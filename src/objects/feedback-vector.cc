@@ -4,6 +4,7 @@
 
 #include "src/objects/feedback-vector.h"
 
+#include "src/codegen/feedback-profile.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-factory-inl.h"
@@ -249,6 +250,16 @@ Handle<FeedbackVector> FeedbackVector::New(
 
   DCHECK_EQ(vector->length(), slot_count);
 
+  if (FLAG_turbo_share_optimized_code) {
+    // A second feedback vector for {shared} means that there are closures
+    // with separate feedback, between which optimized code should be shared.
+    if (shared->has_allocated_feedback_vector()) {
+      shared->set_shares_optimized_code(true);
+    } else {
+      shared->set_has_allocated_feedback_vector(true);
+    }
+  }
+
   DCHECK_EQ(vector->shared_function_info(), *shared);
   DCHECK_EQ(vector->optimization_marker(),
             FLAG_log_function_events ? OptimizationMarker::kLogFirstExecution
@@ -322,6 +333,9 @@ Handle<FeedbackVector> FeedbackVector::New(
       isolate->is_collecting_type_profile()) {
     AddToVectorsForProfilingTools(isolate, result);
   }
+  if (V8_UNLIKELY(isolate->feedback_profile_table() != nullptr)) {
+    FeedbackProfile::ApplyTo(isolate, result);
+  }
   return result;
 }
 
@@ -425,6 +439,34 @@ void FeedbackVector::ClearOptimizationTier() {
   set_flags(state);
 }
 
+void FeedbackVector::RecordDeoptimization(DeoptimizeReason reason) {
+  STATIC_ASSERT(sizeof(DeoptimizeReason) == 1);
+  int32_t state = flags();
+  int count = DeoptCountBits::decode(state);
+  if (count < DeoptCountBits::kMax) {
+    state = DeoptCountBits::update(state, count + 1);
+  }
+  state = LastDeoptReasonBits::update(state, static_cast<int32_t>(reason));
+  set_flags(state);
+}
+
+// static
+int FeedbackVector::RecordAccessDeopt(Isolate* isolate,
+                                      Handle<FeedbackVector> vector,
+                                      FeedbackSlot slot) {
+  if (!vector->access_deopt_counts().IsByteArray()) {
+    Handle<ByteArray> counts = isolate->factory()->NewByteArray(
+        vector->length(), AllocationType::kOld);
+    memset(counts->GetDataStartAddress(), 0, counts->length());
+    vector->set_access_deopt_counts(*counts);
+  }
+  ByteArray counts = ByteArray::cast(vector->access_deopt_counts());
+  int index = GetIndex(slot);
+  int count = counts.get(index);
+  if (count < kMaxUInt8) counts.set(index, count + 1);
+  return count;
+}
+
 void FeedbackVector::InitializeOptimizationState() {
   int32_t state = 0;
   state = OptimizationMarkerBits::update(
@@ -1248,6 +1290,11 @@ BinaryOperationHint FeedbackNexus::GetBinaryOperationFeedback() const {
   return BinaryOperationHintFromFeedback(feedback);
 }
 
+void FeedbackNexus::ConfigureBinaryOperationAny() {
+  DCHECK_EQ(kind(), FeedbackSlotKind::kBinaryOp);
+  SetFeedback(Smi::FromInt(BinaryOperationFeedback::kAny), SKIP_WRITE_BARRIER);
+}
+
 CompareOperationHint FeedbackNexus::GetCompareOperationFeedback() const {
   DCHECK_EQ(kind(), FeedbackSlotKind::kCompareOp);
   int feedback = GetFeedback().ToSmi().value();
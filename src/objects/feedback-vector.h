@@ -11,6 +11,7 @@
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/common/globals.h"
+#include "src/deoptimizer/deoptimize-reason.h"
 #include "src/objects/elements-kind.h"
 #include "src/objects/map.h"
 #include "src/objects/maybe-object.h"
@@ -212,6 +213,10 @@ class FeedbackVector
 
   inline void clear_invocation_count();
 
+  // Clears the alignment padding of the header, if there is any, so that the
+  // snapshot content is deterministic.
+  inline void clear_padding();
+
   inline Code optimized_code() const;
   inline bool has_optimized_code() const;
   inline bool has_optimization_marker() const;
@@ -229,6 +234,17 @@ class FeedbackVector
   // Clears the optimization marker in the feedback vector.
   void ClearOptimizationMarker();
 
+  // Number of eager and soft deopts of optimized code for this vector, and
+  // the reason for the most recent one. The count saturates.
+  inline int deopt_count() const;
+  inline DeoptimizeReason last_deopt_reason() const;
+  void RecordDeoptimization(DeoptimizeReason reason);
+
+  // Records a failed map or bounds check of the property access at |slot| and
+  // returns how many the site had before. The count saturates.
+  static int RecordAccessDeopt(Isolate* isolate, Handle<FeedbackVector> vector,
+                               FeedbackSlot slot);
+
   // Conversion from a slot to an integer index to the underlying array.
   static int GetIndex(FeedbackSlot slot) { return slot.ToInt(); }
 
@@ -756,6 +772,9 @@ class V8_EXPORT_PRIVATE FeedbackNexus final {
       Handle<Name> name, std::vector<MapAndHandler> const& maps_and_handlers);
 
   BinaryOperationHint GetBinaryOperationFeedback() const;
+  // For BinaryOp ICs: widen the feedback to kAny, so that optimizing compilers
+  // no longer speculate on the operand types.
+  void ConfigureBinaryOperationAny();
   CompareOperationHint GetCompareOperationFeedback() const;
   ForInHint GetForInFeedback() const;
 
@@ -1328,6 +1328,8 @@ FunctionTemplateRareData FunctionTemplateInfo::AllocateFunctionTemplateRareData(
       i::Handle<FunctionTemplateRareData>::cast(struct_obj);
   rare_data->set_c_function(Smi(0));
   rare_data->set_c_signature(Smi(0));
+  rare_data->set_c_function_overloads(
+      ReadOnlyRoots(isolate).empty_fixed_array());
   function_template_info->set_rare_data(*rare_data);
   return *rare_data;
 }
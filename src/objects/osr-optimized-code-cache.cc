@@ -18,7 +18,7 @@ const int OSROptimizedCodeCache::kMaxLength;
 void OSROptimizedCodeCache::AddOptimizedCode(
     Handle<NativeContext> native_context, Handle<SharedFunctionInfo> shared,
     Handle<Code> code, BailoutId osr_offset) {
-  DCHECK(!osr_offset.IsNone());
+  DCHECK_IMPLIES(osr_offset.IsNone(), FLAG_turbo_share_optimized_code);
   DCHECK(CodeKindIsOptimizedJSFunction(code->kind()));
   STATIC_ASSERT(kEntryLength == 3);
   Isolate* isolate = native_context->GetIsolate();
@@ -27,9 +27,12 @@ void OSROptimizedCodeCache::AddOptimizedCode(
   Handle<OSROptimizedCodeCache> osr_cache(
       native_context->GetOSROptimizedCodeCache(), isolate);
 
-  DCHECK_EQ(osr_cache->FindEntry(shared, osr_offset), -1);
-  int entry = -1;
-  for (int index = 0; index < osr_cache->length(); index += kEntryLength) {
+  // Function entry code can be produced for several closures of {shared}
+  // concurrently, in which case the latest code replaces the existing entry.
+  int entry = osr_cache->FindEntry(shared, osr_offset);
+  DCHECK_IMPLIES(!osr_offset.IsNone(), entry == -1);
+  for (int index = 0; entry == -1 && index < osr_cache->length();
+       index += kEntryLength) {
     if (osr_cache->Get(index + kSharedOffset)->IsCleared() ||
         osr_cache->Get(index + kCachedCodeOffset)->IsCleared()) {
       entry = index;
@@ -168,7 +171,6 @@ BailoutId OSROptimizedCodeCache::GetBailoutIdFromEntry(int index) {
 int OSROptimizedCodeCache::FindEntry(Handle<SharedFunctionInfo> shared,
                                      BailoutId osr_offset) {
   DisallowHeapAllocation no_gc;
-  DCHECK(!osr_offset.IsNone());
   for (int index = 0; index < length(); index += kEntryLength) {
     if (GetSFIFromEntry(index) != *shared) continue;
     if (GetBailoutIdFromEntry(index) != osr_offset) continue;
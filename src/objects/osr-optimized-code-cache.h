@@ -29,7 +29,9 @@ class V8_EXPORT OSROptimizedCodeCache : public WeakFixedArray {
   // Caches the optimized code |code| corresponding to the shared function
   // |shared| and bailout id |osr_offset| in the OSROptimized code cache.
   // If the OSR code cache wasn't created before it creates a code cache with
-  // kOSRCodeCacheInitialLength entries.
+  // kOSRCodeCacheInitialLength entries. An |osr_offset| of BailoutId::None()
+  // denotes code for the function entry, which is shared between closures
+  // that don't share a feedback vector (see --turbo-share-optimized-code).
   static void AddOptimizedCode(Handle<NativeContext> context,
                                Handle<SharedFunctionInfo> shared,
                                Handle<Code> code, BailoutId osr_offset);
@@ -194,6 +194,12 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_optimized_at_least_once,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, may_have_cached_code,
                     SharedFunctionInfo::MayHaveCachedCodeBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_allocated_feedback_vector,
+                    SharedFunctionInfo::HasAllocatedFeedbackVectorBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, shares_optimized_code,
+                    SharedFunctionInfo::SharesOptimizedCodeBit)
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
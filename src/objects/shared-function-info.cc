@@ -284,6 +284,11 @@ void SharedFunctionInfo::DiscardCompiledMetadata(
     DCHECK(outer_scope_info().IsScopeInfo() || outer_scope_info().IsTheHole());
   }
 
+  // Feedback vectors go away with the metadata, so a vector allocated after
+  // recompilation doesn't mean that there are several closures.
+  set_has_allocated_feedback_vector(false);
+  set_shares_optimized_code(false);
+
   // TODO(rmcilroy): Possibly discard ScopeInfo here as well.
 }
 
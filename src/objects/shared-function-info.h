@@ -422,6 +422,15 @@ class SharedFunctionInfo : public HeapObject {
   // hence the 'may'.
   DECL_BOOLEAN_ACCESSORS(may_have_cached_code)
 
+  // True if a feedback vector has been allocated for this SFI before. Only
+  // tracked with --turbo-share-optimized-code.
+  DECL_BOOLEAN_ACCESSORS(has_allocated_feedback_vector)
+
+  // True if closures of this SFI with separate feedback vectors exist, in
+  // which case optimized code is compiled to be shared between them (see
+  // --turbo-share-optimized-code).
+  DECL_BOOLEAN_ACCESSORS(shares_optimized_code)
+
   // Returns the cached Code object for this SFI if it exists, an empty handle
   // otherwise.
   MaybeHandle<Code> TryGetCachedCode(Isolate* isolate);
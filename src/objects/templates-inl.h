@@ -81,6 +81,8 @@ RARE_ACCESSORS(instance_call_handler, InstanceCallHandler, HeapObject,
 RARE_ACCESSORS(access_check_info, AccessCheckInfo, HeapObject, undefined)
 RARE_ACCESSORS(c_function, CFunction, Object, Smi(0))
 RARE_ACCESSORS(c_signature, CSignature, Object, Smi(0))
+RARE_ACCESSORS(c_function_overloads, CFunctionOverloads, FixedArray,
+               GetReadOnlyRoots(isolate).empty_fixed_array())
 #undef RARE_ACCESSORS
 
 bool FunctionTemplateInfo::instantiated() {
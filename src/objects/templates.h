@@ -85,6 +85,7 @@ class FunctionTemplateInfo
 
   DECL_RARE_ACCESSORS(c_function, CFunction, Object)
   DECL_RARE_ACCESSORS(c_signature, CSignature, Object)
+  DECL_RARE_ACCESSORS(c_function_overloads, CFunctionOverloads, FixedArray)
 #undef DECL_RARE_ACCESSORS
 
   DECL_RELEASE_ACQUIRE_ACCESSORS(call_code, HeapObject)
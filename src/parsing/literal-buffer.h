@@ -6,6 +6,7 @@
 #define V8_PARSING_LITERAL_BUFFER_H_
 
 #include "src/strings/unicode-decoder.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/vector.h"
 
 namespace v8 {
@@ -34,6 +35,18 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Adds |length| ASCII code units from |chars|.
+  V8_INLINE void AddAsciiChars(const uint16_t* chars, int length) {
+    int size = is_one_byte() ? length : length * kUC16Size;
+    while (position_ + size > backing_store_.length()) ExpandBuffer();
+    if (is_one_byte()) {
+      CopyChars(backing_store_.begin() + position_, chars, length);
+    } else {
+      MemCopy(backing_store_.begin() + position_, chars, size);
+    }
+    position_ += size;
+  }
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(Vector<const char> keyword) const {
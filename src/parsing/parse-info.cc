@@ -179,6 +179,8 @@ ParseInfo::ParseInfo(const UnoptimizedCompileFlags flags,
       state_(state),
       zone_(std::make_unique<Zone>(state->allocator(), "parser-zone")),
       extension_(nullptr),
+      compile_hint_callback_(nullptr),
+      compile_hint_callback_data_(nullptr),
       script_scope_(nullptr),
       stack_limit_(0),
       parameters_end_pos_(kNoSourcePosition),
@@ -272,6 +272,18 @@ class V8_EXPORT_PRIVATE ParseInfo {
   v8::Extension* extension() const { return extension_; }
   void set_extension(v8::Extension* extension) { extension_ = extension; }
 
+  v8::ScriptCompiler::CompileHintCallback compile_hint_callback() const {
+    return compile_hint_callback_;
+  }
+  void* compile_hint_callback_data() const {
+    return compile_hint_callback_data_;
+  }
+  void set_compile_hint_callback(
+      v8::ScriptCompiler::CompileHintCallback callback, void* data) {
+    compile_hint_callback_ = callback;
+    compile_hint_callback_data_ = data;
+  }
+
   void set_consumed_preparse_data(std::unique_ptr<ConsumedPreparseData> data) {
     consumed_preparse_data_.swap(data);
   }
@@ -334,6 +346,8 @@ class V8_EXPORT_PRIVATE ParseInfo {
 
   std::unique_ptr<Zone> zone_;
   v8::Extension* extension_;
+  v8::ScriptCompiler::CompileHintCallback compile_hint_callback_;
+  void* compile_hint_callback_data_;
   DeclarationScope* script_scope_;
   uintptr_t stack_limit_;
   int parameters_end_pos_;
@@ -2513,6 +2513,15 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
           ? FunctionLiteral::kShouldEagerCompile
           : default_eager_compile_hint();
 
+  // The embedder's compile hints identify functions by the position of their
+  // parameter list, which is where the function's scope starts.
+  if (V8_UNLIKELY(info()->compile_hint_callback() != nullptr) &&
+      eager_compile_hint == FunctionLiteral::kShouldLazyCompile &&
+      info()->compile_hint_callback()(peek_position(),
+                                      info()->compile_hint_callback_data())) {
+    eager_compile_hint = FunctionLiteral::kShouldEagerCompile;
+  }
+
   // Determine if the function can be parsed lazily. Lazy parsing is
   // different from lazy compilation; we need to parse more eagerly than we
   // compile.
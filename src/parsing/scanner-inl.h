@@ -6,6 +6,7 @@
 #define V8_PARSING_SCANNER_INL_H_
 
 #include "src/parsing/keywords-gen.h"
+#include "src/parsing/scanner-simd.h"
 #include "src/parsing/scanner.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/utils/utils.h"
@@ -273,7 +274,18 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
-      AdvanceUntil([this, &scan_flags](uc32 c0) {
+      auto skip_run = [this, &scan_flags](const uint16_t* start,
+                                          const uint16_t* end) {
+        bool can_be_keyword = true;
+        const uint16_t* run_end =
+            SkipAsciiIdentifierText(start, end, &can_be_keyword);
+        if (!can_be_keyword) {
+          scan_flags |= static_cast<uint8_t>(ScanFlags::kCannotBeKeyword);
+        }
+        AddLiteralChars(start, run_end);
+        return run_end;
+      };
+      AdvanceUntil(skip_run, [this, &scan_flags](uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           // A non-ascii character means we need to drop through to the slow
           // path.
@@ -323,12 +335,13 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
   // We won't skip behind the end of input.
   DCHECK(!IsWhiteSpaceOrLineTerminator(kEndOfInput));
 
-  // Advance as long as character is a WhiteSpace or LineTerminator.
+  // Advance as long as character is a WhiteSpace or LineTerminator. Runs of
+  // spaces and tabs are skipped at once.
   while (IsWhiteSpaceOrLineTerminator(c0_)) {
     if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
       next().after_line_terminator = true;
     }
-    Advance();
+    AdvanceUntil(SkipAsciiSpaces, [](uc32 c0) { return true; });
   }
 
   // Return whether or not we skipped any characters.
@@ -0,0 +1,227 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_SCANNER_SIMD_H_
+#define V8_PARSING_SCANNER_SIMD_H_
+
+#include <cstdint>
+
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
+#include "src/base/macros.h"
+
+#if V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#define V8_SCANNER_SIMD_SSE2 1
+#elif V8_HOST_ARCH_ARM64
+#include <arm_neon.h>
+#define V8_SCANNER_SIMD_NEON 1
+#endif
+
+namespace v8 {
+namespace internal {
+
+// Vectorized searches over the scanner's UTF-16 buffer. Each SkipAscii*
+// function returns the end of the run of code units starting at |start| that
+// the scanner can treat as plain content, i.e. the first code unit in
+// [start, end) that needs the scanner's attention, or |end|. The runs only
+// ever cover ASCII, every other code unit ends them and is left to the
+// scanner's scalar path.
+
+#if V8_SCANNER_SIMD_SSE2 || V8_SCANNER_SIMD_NEON
+
+// Eight UTF-16 code units, or a lane mask of them.
+class ScannerVector {
+ public:
+  static constexpr int kLanes = 8;
+
+#if V8_SCANNER_SIMD_SSE2
+  static V8_INLINE ScannerVector Load(const uint16_t* chars) {
+    return ScannerVector(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars)));
+  }
+
+  V8_INLINE ScannerVector Equals(uint16_t c) const {
+    return ScannerVector(
+        _mm_cmpeq_epi16(value_, _mm_set1_epi16(static_cast<int16_t>(c))));
+  }
+
+  // Unsigned |lo| <= c <= |hi|.
+  V8_INLINE ScannerVector InRange(uint16_t lo, uint16_t hi) const {
+    __m128i offset =
+        _mm_sub_epi16(value_, _mm_set1_epi16(static_cast<int16_t>(lo)));
+    __m128i above = _mm_subs_epu16(
+        offset, _mm_set1_epi16(static_cast<int16_t>(hi - lo)));
+    return ScannerVector(_mm_cmpeq_epi16(above, _mm_setzero_si128()));
+  }
+
+  V8_INLINE ScannerVector operator|(ScannerVector other) const {
+    return ScannerVector(_mm_or_si128(value_, other.value_));
+  }
+
+  // This mask without the lanes set in |other|.
+  V8_INLINE ScannerVector Without(ScannerVector other) const {
+    return ScannerVector(_mm_andnot_si128(other.value_, value_));
+  }
+
+  V8_INLINE ScannerVector Not() const {
+    return ScannerVector(_mm_xor_si128(value_, _mm_set1_epi16(-1)));
+  }
+
+  // The index of the first lane set in this mask, or kLanes.
+  V8_INLINE int FirstSetLane() const {
+    uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(value_));
+    if (bits == 0) return kLanes;
+    return base::bits::CountTrailingZeros32(bits) / 2;
+  }
+
+ private:
+  explicit ScannerVector(__m128i value) : value_(value) {}
+
+  __m128i value_;
+#elif V8_SCANNER_SIMD_NEON
+  static V8_INLINE ScannerVector Load(const uint16_t* chars) {
+    return ScannerVector(vld1q_u16(chars));
+  }
+
+  V8_INLINE ScannerVector Equals(uint16_t c) const {
+    return ScannerVector(vceqq_u16(value_, vdupq_n_u16(c)));
+  }
+
+  // Unsigned |lo| <= c <= |hi|.
+  V8_INLINE ScannerVector InRange(uint16_t lo, uint16_t hi) const {
+    uint16x8_t offset = vsubq_u16(value_, vdupq_n_u16(lo));
+    return ScannerVector(vcleq_u16(offset, vdupq_n_u16(hi - lo)));
+  }
+
+  V8_INLINE ScannerVector operator|(ScannerVector other) const {
+    return ScannerVector(vorrq_u16(value_, other.value_));
+  }
+
+  // This mask without the lanes set in |other|.
+  V8_INLINE ScannerVector Without(ScannerVector other) const {
+    return ScannerVector(vbicq_u16(value_, other.value_));
+  }
+
+  V8_INLINE ScannerVector Not() const {
+    return ScannerVector(vmvnq_u16(value_));
+  }
+
+  // The index of the first lane set in this mask, or kLanes.
+  V8_INLINE int FirstSetLane() const {
+    // Narrow each 16-bit lane of the mask to one byte.
+    uint64_t bits = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(value_, 4)), 0);
+    if (bits == 0) return kLanes;
+    return base::bits::CountTrailingZeros64(bits) / 8;
+  }
+
+ private:
+  explicit ScannerVector(uint16x8_t value) : value_(value) {}
+
+  uint16x8_t value_;
+#endif
+};
+
+#define V8_SCANNER_SIMD 1
+#endif  // V8_SCANNER_SIMD_SSE2 || V8_SCANNER_SIMD_NEON
+
+// Returns the first code unit in [start, end) for which |stop| holds, or
+// |end|. |vector_stop| computes the lane mask of |stop| for a whole vector.
+template <typename VectorStop, typename ScalarStop>
+V8_INLINE const uint16_t* FindFirstScannerStop(const uint16_t* start,
+                                               const uint16_t* end,
+                                               VectorStop vector_stop,
+                                               ScalarStop stop) {
+  const uint16_t* cursor = start;
+#if V8_SCANNER_SIMD
+  while (end - cursor >= ScannerVector::kLanes) {
+    int lane = vector_stop(ScannerVector::Load(cursor)).FirstSetLane();
+    if (lane < ScannerVector::kLanes) return cursor + lane;
+    cursor += ScannerVector::kLanes;
+  }
+#else
+  USE(vector_stop);
+#endif
+  while (cursor < end && !stop(*cursor)) ++cursor;
+  return cursor;
+}
+
+// Comment text up to a '*', a line terminator or a non-ASCII character.
+V8_INLINE const uint16_t* SkipAsciiCommentText(const uint16_t* start,
+                                               const uint16_t* end) {
+  return FindFirstScannerStop(
+      start, end,
+      [](auto chars) {
+        return chars.InRange(0x80, 0xFFFF) | chars.Equals('\n') |
+               chars.Equals('\r') | chars.Equals('*');
+      },
+      [](uint16_t c) {
+        return c >= 0x80 || c == '\n' || c == '\r' || c == '*';
+      });
+}
+
+// String literal contents up to a quote, a backslash, a line terminator or a
+// non-ASCII character.
+V8_INLINE const uint16_t* SkipAsciiStringText(const uint16_t* start,
+                                              const uint16_t* end) {
+  return FindFirstScannerStop(
+      start, end,
+      [](auto chars) {
+        return chars.InRange(0x80, 0xFFFF) | chars.Equals('\'') |
+               chars.Equals('"') | chars.Equals('\\') | chars.Equals('\n') |
+               chars.Equals('\r');
+      },
+      [](uint16_t c) {
+        return c >= 0x80 || c == '\'' || c == '"' || c == '\\' || c == '\n' ||
+               c == '\r';
+      });
+}
+
+// Spaces and tabs.
+V8_INLINE const uint16_t* SkipAsciiSpaces(const uint16_t* start,
+                                          const uint16_t* end) {
+  return FindFirstScannerStop(
+      start, end,
+      [](auto chars) { return (chars.Equals(' ') | chars.Equals('\t')).Not(); },
+      [](uint16_t c) { return c != ' ' && c != '\t'; });
+}
+
+// ASCII identifier parts, [a-zA-Z0-9_$]. Clears |*can_be_keyword| if the run
+// contains anything but lowercase letters.
+V8_INLINE const uint16_t* SkipAsciiIdentifierText(const uint16_t* start,
+                                                  const uint16_t* end,
+                                                  bool* can_be_keyword) {
+  bool only_lowercase = true;
+  const uint16_t* run_end = FindFirstScannerStop(
+      start, end,
+      [&only_lowercase](auto chars) {
+        auto lowercase = chars.InRange('a', 'z');
+        auto identifier = lowercase | chars.InRange('A', 'Z') |
+                          chars.InRange('0', '9') | chars.Equals('_') |
+                          chars.Equals('$');
+        auto stop = identifier.Not();
+        if (identifier.Without(lowercase).FirstSetLane() <
+            stop.FirstSetLane()) {
+          only_lowercase = false;
+        }
+        return stop;
+      },
+      [&only_lowercase](uint16_t c) {
+        if (c >= 'a' && c <= 'z') return false;
+        if ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' ||
+            c == '$') {
+          only_lowercase = false;
+          return false;
+        }
+        return true;
+      });
+  if (!only_lowercase) *can_be_keyword = false;
+  return run_end;
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_SCANNER_SIMD_H_
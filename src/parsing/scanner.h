@@ -93,6 +93,32 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil above, but lets |skip_run| pass over runs of buffered
+  // code units at once. |skip_run| is called with a range of the buffer and
+  // returns the end of the run at its start, which must consist of code units
+  // that |check| would not stop at. Code units outside runs are passed to
+  // |check| one at a time.
+  template <typename SkipRunType, typename FunctionType>
+  V8_INLINE uc32 AdvanceUntil(SkipRunType skip_run, FunctionType check) {
+    while (true) {
+      const uint16_t* cursor = skip_run(buffer_cursor_, buffer_end_);
+      while (cursor < buffer_end_) {
+        uc32 c0_ = static_cast<uc32>(*cursor);
+        if (check(c0_)) {
+          buffer_cursor_ = cursor + 1;
+          return c0_;
+        }
+        cursor = skip_run(cursor + 1, buffer_end_);
+      }
+
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlockChecked()) {
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -506,6 +532,11 @@ class V8_EXPORT_PRIVATE Scanner {
 
   V8_INLINE void AddLiteralChar(char c) { next().literal_chars.AddChar(c); }
 
+  // Adds the ASCII code units in [start, end) to the current literal.
+  V8_INLINE void AddLiteralChars(const uint16_t* start, const uint16_t* end) {
+    next().literal_chars.AddAsciiChars(start, static_cast<int>(end - start));
+  }
+
   V8_INLINE void AddRawLiteralChar(uc32 c) {
     next().raw_literal_chars.AddChar(c);
   }
@@ -529,6 +560,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename SkipRunType, typename FunctionType>
+  V8_INLINE void AdvanceUntil(SkipRunType skip_run, FunctionType check) {
+    c0_ = source_->AdvanceUntil(skip_run, check);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -154,6 +154,51 @@ RUNTIME_FUNCTION(Runtime_BigIntBinaryOp) {
   RETURN_RESULT_OR_FAILURE(isolate, result);
 }
 
+// Used by optimized code for BigInt operations that have no builtin. Instead
+// of throwing, returns Smi zero when the result would be too big, or when a
+// multiplication is long enough to check for interrupts, so that the caller
+// can deoptimize and redo the operation in unoptimized code. The deopt widens
+// the operation's feedback, so that it isn't speculated on again.
+RUNTIME_FUNCTION(Runtime_BigIntBinaryOpNoThrow) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(BigInt, left, 0);
+  CONVERT_ARG_HANDLE_CHECKED(BigInt, right, 1);
+  CONVERT_SMI_ARG_CHECKED(opcode, 2);
+  Operation op = static_cast<Operation>(opcode);
+
+  // BigInt::Multiply checks for interrupts after this amount of work.
+  static const int64_t kMaxUninterruptedMultiplyWork = 5000000;
+  MaybeHandle<BigInt> result;
+  switch (op) {
+    case Operation::kMultiply:
+      if (left->length() + right->length() > BigInt::kMaxLength ||
+          static_cast<int64_t>(left->length()) * right->length() >
+              kMaxUninterruptedMultiplyWork) {
+        return Smi::zero();
+      }
+      result = BigInt::Multiply(isolate, left, right);
+      break;
+    case Operation::kBitwiseAnd:
+    case Operation::kBitwiseOr:
+    case Operation::kBitwiseXor:
+      if (std::max(left->length(), right->length()) + 1 > BigInt::kMaxLength) {
+        return Smi::zero();
+      }
+      if (op == Operation::kBitwiseAnd) {
+        result = BigInt::BitwiseAnd(isolate, left, right);
+      } else if (op == Operation::kBitwiseOr) {
+        result = BigInt::BitwiseOr(isolate, left, right);
+      } else {
+        result = BigInt::BitwiseXor(isolate, left, right);
+      }
+      break;
+    default:
+      UNREACHABLE();
+  }
+  return *result.ToHandleChecked();
+}
+
 RUNTIME_FUNCTION(Runtime_BigIntUnaryOp) {
   HandleScope scope(isolate);
   DCHECK_EQ(2, args.length());
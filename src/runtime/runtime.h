@@ -69,6 +69,7 @@ namespace internal {
 
 #define FOR_EACH_INTRINSIC_BIGINT(F, I) \
   F(BigIntBinaryOp, 3, 1)               \
+  F(BigIntBinaryOpNoThrow, 3, 1)        \
   F(BigIntCompareToBigInt, 3, 1)        \
   F(BigIntCompareToNumber, 3, 1)        \
   F(BigIntCompareToString, 3, 1)        \
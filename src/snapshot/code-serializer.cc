@@ -8,8 +8,12 @@
 #include "src/codegen/macro-assembler.h"
 #include "src/common/globals.h"
 #include "src/debug/debug.h"
+#include "src/execution/local-isolate.h"
+#include "src/handles/local-handles-inl.h"
+#include "src/handles/persistent-handles.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-factory-inl.h"
+#include "src/heap/local-heap.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/objects/objects-inl.h"
@@ -260,37 +264,111 @@ void CreateInterpreterDataForDeserializedCode(Isolate* isolate,
 #endif  // V8_TARGET_ARCH_ARM
 
 namespace {
+
+void FinalizeDeserialization(Isolate* isolate,
+                             Handle<SharedFunctionInfo> result,
+                             const base::ElapsedTimer& timer) {
+  const bool log_code_creation =
+      isolate->logger()->is_listening_to_code_events() ||
+      isolate->is_profiling() ||
+      isolate->code_event_dispatcher()->IsListeningToCodeEvents();
+
+#ifndef V8_TARGET_ARCH_ARM
+  if (V8_UNLIKELY(FLAG_interpreted_frames_native_stack))
+    CreateInterpreterDataForDeserializedCode(isolate, result,
+                                             log_code_creation);
+#endif  // V8_TARGET_ARCH_ARM
+
+  bool needs_source_positions = isolate->NeedsSourcePositionsForProfiling();
+
+  if (log_code_creation || FLAG_log_function_events) {
+    Handle<Script> script(Script::cast(result->script()), isolate);
+    Handle<String> name(script->name().IsString()
+                            ? String::cast(script->name())
+                            : ReadOnlyRoots(isolate).empty_string(),
+                        isolate);
+
+    if (FLAG_log_function_events) {
+      LOG(isolate,
+          FunctionEvent("deserialize", script->id(),
+                        timer.Elapsed().InMillisecondsF(),
+                        result->StartPosition(), result->EndPosition(), *name));
+    }
+    if (log_code_creation) {
+      Script::InitLineEnds(isolate, script);
+
+      SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+      for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+           info = iter.Next()) {
+        if (info.is_compiled()) {
+          Handle<SharedFunctionInfo> shared_info(info, isolate);
+          if (needs_source_positions) {
+            SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate,
+                                                               shared_info);
+          }
+          DisallowGarbageCollection no_gc;
+          int line_num =
+              script->GetLineNumber(shared_info->StartPosition()) + 1;
+          int column_num =
+              script->GetColumnNumber(shared_info->StartPosition()) + 1;
+          PROFILE(isolate,
+                  CodeCreateEvent(CodeEventListener::SCRIPT_TAG,
+                                  handle(shared_info->abstract_code(), isolate),
+                                  shared_info, name, line_num, column_num));
+        }
+      }
+    }
+  }
+
+  if (needs_source_positions) {
+    Handle<Script> script(Script::cast(result->script()), isolate);
+    Script::InitLineEnds(isolate, script);
+  }
+}
+
 class StressOffThreadDeserializeThread final : public base::Thread {
  public:
   explicit StressOffThreadDeserializeThread(Isolate* isolate,
-                                            const SerializedCodeData* scd)
+                                            ScriptData* cached_data)
       : Thread(
             base::Thread::Options("StressOffThreadDeserializeThread", 2 * MB)),
         isolate_(isolate),
-        scd_(scd) {}
-
-  MaybeHandle<SharedFunctionInfo> maybe_result() const { return maybe_result_; }
+        cached_data_(cached_data) {}
 
   void Run() final {
     LocalIsolate local_isolate(isolate_, ThreadKind::kBackground);
-    MaybeHandle<SharedFunctionInfo> local_maybe_result =
-        ObjectDeserializer::DeserializeSharedFunctionInfoOffThread(
-            &local_isolate, scd_, local_isolate.factory()->empty_string());
+    UnparkedScope unparked_scope(local_isolate.heap());
+    LocalHandleScope handle_scope(&local_isolate);
+    off_thread_data_ =
+        CodeSerializer::StartDeserializeOffThread(&local_isolate, cached_data_);
+  }
 
-    maybe_result_ =
-        local_isolate.heap()->NewPersistentMaybeHandle(local_maybe_result);
+  MaybeHandle<SharedFunctionInfo> Finalize(Isolate* isolate,
+                                           Handle<String> source,
+                                           ScriptOriginOptions origin_options) {
+    return CodeSerializer::FinishOffThreadDeserialize(
+        isolate, std::move(off_thread_data_), cached_data_, source,
+        origin_options);
   }
 
  private:
   Isolate* isolate_;
-  const SerializedCodeData* scd_;
-  MaybeHandle<SharedFunctionInfo> maybe_result_;
+  ScriptData* cached_data_;
+  CodeSerializer::OffThreadDeserializeData off_thread_data_;
 };
+
 }  // namespace
 
 MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     Isolate* isolate, ScriptData* cached_data, Handle<String> source,
     ScriptOriginOptions origin_options) {
+  if (FLAG_stress_background_compile) {
+    StressOffThreadDeserializeThread thread(isolate, cached_data);
+    CHECK(thread.Start());
+    thread.Join();
+    return thread.Finalize(isolate, source, origin_options);
+  }
+
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization || FLAG_log_function_events) timer.Start();
 
@@ -310,24 +388,8 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
   }
 
   // Deserialize.
-  MaybeHandle<SharedFunctionInfo> maybe_result;
-  // TODO(leszeks): Add LocalHeap support to deserializer
-  if (false && FLAG_stress_background_compile) {
-    StressOffThreadDeserializeThread thread(isolate, &scd);
-    CHECK(thread.Start());
-    thread.Join();
-
-    maybe_result = thread.maybe_result();
-
-    // Fix-up result script source.
-    Handle<SharedFunctionInfo> result;
-    if (maybe_result.ToHandle(&result)) {
-      Script::cast(result->script()).set_source(*source);
-    }
-  } else {
-    maybe_result = ObjectDeserializer::DeserializeSharedFunctionInfo(
-        isolate, &scd, source);
-  }
+  MaybeHandle<SharedFunctionInfo> maybe_result =
+      ObjectDeserializer::DeserializeSharedFunctionInfo(isolate, &scd, source);
 
   Handle<SharedFunctionInfo> result;
   if (!maybe_result.ToHandle(&result)) {
@@ -342,63 +404,231 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     PrintF("[Deserializing from %d bytes took %0.3f ms]\n", length, ms);
   }
 
-  const bool log_code_creation =
-      isolate->logger()->is_listening_to_code_events() ||
-      isolate->is_profiling() ||
-      isolate->code_event_dispatcher()->IsListeningToCodeEvents();
+  FinalizeDeserialization(isolate, result, timer);
 
-#ifndef V8_TARGET_ARCH_ARM
-  if (V8_UNLIKELY(FLAG_interpreted_frames_native_stack))
-    CreateInterpreterDataForDeserializedCode(isolate, result,
-                                             log_code_creation);
-#endif  // V8_TARGET_ARCH_ARM
+  return scope.CloseAndEscape(result);
+}
 
-  bool needs_source_positions = isolate->NeedsSourcePositionsForProfiling();
+// static
+CodeSerializer::OffThreadDeserializeData
+CodeSerializer::StartDeserializeOffThread(LocalIsolate* local_isolate,
+                                          ScriptData* cached_data) {
+  OffThreadDeserializeData result;
+
+  const SerializedCodeData scd =
+      SerializedCodeData::FromCachedDataWithoutSource(
+          cached_data, &result.sanity_check_result);
+  if (result.sanity_check_result != SerializedCodeData::CHECK_SUCCESS) {
+    // Rejections are reported on the main thread, once the source hash has
+    // been checked as well.
+    return result;
+  }
 
-  if (log_code_creation || FLAG_log_function_events) {
-    Handle<Script> script(Script::cast(result->script()), isolate);
-    Handle<String> name(script->name().IsString()
-                            ? String::cast(script->name())
-                            : ReadOnlyRoots(isolate).empty_string(),
-                        isolate);
+  std::vector<Handle<Script>> scripts;
+  MaybeHandle<SharedFunctionInfo> local_maybe_result =
+      ObjectDeserializer::DeserializeSharedFunctionInfoOffThread(
+          local_isolate, &scd, &scripts);
 
-    if (FLAG_log_function_events) {
-      LOG(isolate,
-          FunctionEvent("deserialize", script->id(),
-                        timer.Elapsed().InMillisecondsF(),
-                        result->StartPosition(), result->EndPosition(), *name));
+  result.maybe_result =
+      local_isolate->heap()->NewPersistentMaybeHandle(local_maybe_result);
+  for (Handle<Script> script : scripts) {
+    result.scripts.push_back(
+        local_isolate->heap()->NewPersistentHandle(script));
+  }
+  result.persistent_handles = local_isolate->heap()->DetachPersistentHandles();
+
+  return result;
+}
+
+// static
+MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
+    Isolate* isolate, OffThreadDeserializeData&& data,
+    ScriptData* cached_data, Handle<String> source,
+    ScriptOriginOptions origin_options) {
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization || FLAG_log_function_events) timer.Start();
+
+  HandleScope scope(isolate);
+
+  // The checksum was verified off-thread, only the source is left to check.
+  SerializedCodeData::SanityCheckResult sanity_check_result =
+      SerializedCodeData(cached_data)
+          .SanityCheckJustSource(
+              SerializedCodeData::SourceHash(source, origin_options));
+  if (sanity_check_result == SerializedCodeData::CHECK_SUCCESS) {
+    sanity_check_result = data.sanity_check_result;
+  }
+  if (sanity_check_result != SerializedCodeData::CHECK_SUCCESS) {
+    if (FLAG_profile_deserialization) PrintF("[Cached code failed check]\n");
+    cached_data->Reject();
+    isolate->counters()->code_cache_reject_reason()->AddSample(
+        sanity_check_result);
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+
+  Handle<SharedFunctionInfo> result;
+  if (!data.maybe_result.ToHandle(&result)) {
+    // Deserializing may fail if the reservations cannot be fulfilled.
+    if (FLAG_profile_deserialization) {
+      PrintF("[Off-thread deserializing failed]\n");
     }
-    if (log_code_creation) {
-      Script::InitLineEnds(isolate, script);
+    return MaybeHandle<SharedFunctionInfo>();
+  }
 
-      SharedFunctionInfo::ScriptIterator iter(isolate, *script);
-      for (SharedFunctionInfo info = iter.Next(); !info.is_null();
-           info = iter.Next()) {
-        if (info.is_compiled()) {
-          Handle<SharedFunctionInfo> shared_info(info, isolate);
-          if (needs_source_positions) {
-            SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate,
-                                                               shared_info);
-          }
-          DisallowGarbageCollection no_gc;
-          int line_num =
-              script->GetLineNumber(shared_info->StartPosition()) + 1;
-          int column_num =
-              script->GetColumnNumber(shared_info->StartPosition()) + 1;
-          PROFILE(isolate,
-                  CodeCreateEvent(CodeEventListener::SCRIPT_TAG,
-                                  handle(shared_info->abstract_code(), isolate),
-                                  shared_info, name, line_num, column_num));
-        }
-      }
+  // The deserialized objects are referenced by persistent handles, which die
+  // with |data|, so move them to the main thread's handle scope.
+  result = handle(*result, isolate);
+
+  // Attach the scripts to the isolate: fix up their source, which was not
+  // known off-thread, and register them with the script list, the logger and
+  // the profilers.
+  DCHECK_EQ(data.scripts.size(), 1);
+  for (Handle<Script> off_thread_script : data.scripts) {
+    Handle<Script> script = handle(*off_thread_script, isolate);
+    script->set_source(*source);
+    LOG(isolate,
+        ScriptEvent(Logger::ScriptEventType::kDeserialize, script->id()));
+    LOG(isolate, ScriptDetails(*script));
+    Handle<WeakArrayList> list = isolate->factory()->script_list();
+    list = WeakArrayList::AddToEnd(isolate, list,
+                                   MaybeObjectHandle::Weak(script));
+    isolate->heap()->SetRootScriptList(*list);
+  }
+
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    int length = cached_data->length();
+    PrintF("[Finishing off-thread deserialize from %d bytes took %0.3f ms]\n",
+           length, ms);
+  }
+
+  FinalizeDeserialization(isolate, result, timer);
+
+  return scope.CloseAndEscape(result);
+}
+
+namespace {
+
+// Points the SharedFunctionInfos in the constant pool of |bytecode| at their
+// counterparts in |script|.
+void RelinkInnerFunctions(Isolate* isolate, BytecodeArray bytecode,
+                          Handle<Script> script) {
+  FixedArray constant_pool = bytecode.constant_pool();
+  for (int i = 0; i < constant_pool.length(); i++) {
+    Object entry = constant_pool.get(i);
+    if (!entry.IsSharedFunctionInfo()) continue;
+    SharedFunctionInfo inner = SharedFunctionInfo::cast(entry);
+    if (inner.script() == *script) continue;
+    Handle<SharedFunctionInfo> target;
+    CHECK(script->FindSharedFunctionInfo(isolate, inner.function_literal_id())
+              .ToHandle(&target));
+    constant_pool.set(i, *target);
+  }
+}
+
+// Installs the compiled state of |from| into the still lazy |to|, mirroring
+// what a lazy compile of |to| would have done.
+void InstallCompiledData(Handle<SharedFunctionInfo> from,
+                         Handle<SharedFunctionInfo> to) {
+  DCHECK(from->is_compiled());
+  DCHECK(!to->is_compiled());
+  DCHECK_EQ(from->function_literal_id(), to->function_literal_id());
+
+  to->set_has_duplicate_parameters(from->has_duplicate_parameters());
+  to->set_is_oneshot_iife(from->is_oneshot_iife());
+  if (!to->are_properties_final()) {
+    to->set_expected_nof_properties(from->expected_nof_properties());
+    to->set_are_properties_final(from->are_properties_final());
+  }
+  to->set_class_scope_has_private_brand(from->class_scope_has_private_brand());
+  to->set_has_static_private_methods_or_accessors(
+      from->has_static_private_methods_or_accessors());
+  to->SetScopeInfo(from->scope_info());
+  to->set_raw_outer_scope_info_or_feedback_metadata(from->feedback_metadata());
+  if (from->HasInterpreterData()) {
+    to->set_interpreter_data(from->interpreter_data());
+  } else {
+    to->set_bytecode_array(from->GetBytecodeArray());
+  }
+  if (from->optimization_disabled()) {
+    to->DisableOptimization(from->disable_optimization_reason());
+  }
+}
+
+}  // namespace
+
+// static
+bool CodeSerializer::MergeIntoScript(Isolate* isolate,
+                                     ScriptData* cached_data,
+                                     Handle<Script> script) {
+  HandleScope scope(isolate);
+  Handle<String> source(String::cast(script->source()), isolate);
+  Handle<SharedFunctionInfo> toplevel;
+  if (!Deserialize(isolate, cached_data, source, script->origin_options())
+           .ToHandle(&toplevel)) {
+    if (!cached_data->rejected()) cached_data->Reject();
+    return false;
+  }
+  Handle<Script> update(Script::cast(toplevel->script()), isolate);
+  int function_count = script->shared_function_infos().length();
+  if (update->shared_function_infos().length() != function_count) {
+    cached_data->Reject();
+    return false;
+  }
+  // Block coverage and type profiles need instrumented bytecode, which only a
+  // real compile produces. Keep the data, but leave the script lazy.
+  if (isolate->is_block_code_coverage() ||
+      isolate->is_collecting_type_profile()) {
+    return true;
+  }
+
+  // Functions the script does not know about at all move over from the
+  // update as they are. Functions that are lazy in the script take over the
+  // compiled data from the update. Either way the bytecode now belongs to
+  // |script|, and its inner functions are relinked to it below.
+  std::vector<Handle<SharedFunctionInfo>> adopted;
+  std::vector<Handle<SharedFunctionInfo>> installed;
+  for (int id = 0; id < function_count; id++) {
+    Handle<SharedFunctionInfo> from;
+    if (!update->FindSharedFunctionInfo(isolate, id).ToHandle(&from)) continue;
+    Handle<SharedFunctionInfo> to;
+    if (!script->FindSharedFunctionInfo(isolate, id).ToHandle(&to)) {
+      from->SetScript(ReadOnlyRoots(isolate),
+                      ReadOnlyRoots(isolate).undefined_value(), id, false);
+      from->SetScript(ReadOnlyRoots(isolate), *script, id, false);
+      if (from->is_compiled()) adopted.push_back(from);
+    } else if (from->is_compiled() && !to->is_compiled() &&
+               !to->HasDebugInfo()) {
+      InstallCompiledData(from, to);
+      installed.push_back(to);
     }
   }
 
-  if (needs_source_positions) {
-    Handle<Script> script(Script::cast(result->script()), isolate);
+  for (Handle<SharedFunctionInfo> shared : adopted) {
+    RelinkInnerFunctions(isolate, shared->GetBytecodeArray(), script);
+  }
+  for (Handle<SharedFunctionInfo> shared : installed) {
+    RelinkInnerFunctions(isolate, shared->GetBytecodeArray(), script);
+  }
+
+  if (isolate->logger()->is_listening_to_code_events() ||
+      isolate->is_profiling() ||
+      isolate->code_event_dispatcher()->IsListeningToCodeEvents()) {
     Script::InitLineEnds(isolate, script);
+    Handle<String> name(script->name().IsString()
+                            ? String::cast(script->name())
+                            : ReadOnlyRoots(isolate).empty_string(),
+                        isolate);
+    for (Handle<SharedFunctionInfo> shared : installed) {
+      int line_num = script->GetLineNumber(shared->StartPosition()) + 1;
+      int column_num = script->GetColumnNumber(shared->StartPosition()) + 1;
+      PROFILE(isolate,
+              CodeCreateEvent(CodeEventListener::FUNCTION_TAG,
+                              handle(shared->abstract_code(), isolate), shared,
+                              name, line_num, column_num));
+    }
   }
-  return scope.CloseAndEscape(result);
+  return true;
 }
 
 SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
@@ -434,16 +664,33 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
 
 SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
     uint32_t expected_source_hash) const {
+  SanityCheckResult result = SanityCheckJustSource(expected_source_hash);
+  if (result != CHECK_SUCCESS) return result;
+  return SanityCheckWithoutSource();
+}
+
+SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheckJustSource(
+    uint32_t expected_source_hash) const {
   if (this->size_ < kHeaderSize) return INVALID_HEADER;
   uint32_t magic_number = GetMagicNumber();
   if (magic_number != kMagicNumber) return MAGIC_NUMBER_MISMATCH;
   uint32_t version_hash = GetHeaderValue(kVersionHashOffset);
+  if (version_hash != Version::Hash()) return VERSION_MISMATCH;
   uint32_t source_hash = GetHeaderValue(kSourceHashOffset);
+  if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
+  return CHECK_SUCCESS;
+}
+
+SerializedCodeData::SanityCheckResult
+SerializedCodeData::SanityCheckWithoutSource() const {
+  if (this->size_ < kHeaderSize) return INVALID_HEADER;
+  uint32_t magic_number = GetMagicNumber();
+  if (magic_number != kMagicNumber) return MAGIC_NUMBER_MISMATCH;
+  uint32_t version_hash = GetHeaderValue(kVersionHashOffset);
   uint32_t flags_hash = GetHeaderValue(kFlagHashOffset);
   uint32_t payload_length = GetHeaderValue(kPayloadLengthOffset);
   uint32_t c = GetHeaderValue(kChecksumOffset);
   if (version_hash != Version::Hash()) return VERSION_MISMATCH;
-  if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
   if (flags_hash != FlagList::Hash()) return FLAGS_MISMATCH;
   uint32_t max_payload_length = this->size_ - kHeaderSize;
   if (payload_length > max_payload_length) return LENGTH_MISMATCH;
@@ -496,5 +743,16 @@ SerializedCodeData SerializedCodeData::FromCachedData(
   return scd;
 }
 
+SerializedCodeData SerializedCodeData::FromCachedDataWithoutSource(
+    ScriptData* cached_data, SanityCheckResult* rejection_result) {
+  DisallowGarbageCollection no_gc;
+  SerializedCodeData scd(cached_data);
+  *rejection_result = scd.SanityCheckWithoutSource();
+  if (*rejection_result != CHECK_SUCCESS) {
+    return SerializedCodeData(nullptr, 0);
+  }
+  return scd;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -6,6 +6,7 @@
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
 #include "src/base/macros.h"
+#include "src/handles/persistent-handles.h"
 #include "src/snapshot/serializer.h"
 #include "src/snapshot/snapshot-data.h"
 
@@ -46,6 +47,10 @@ class V8_EXPORT_PRIVATE ScriptData {
 
 class CodeSerializer : public Serializer {
  public:
+  // The result of deserializing a code cache on a background thread, to be
+  // finished on the main thread.
+  struct OffThreadDeserializeData;
+
   CodeSerializer(const CodeSerializer&) = delete;
   CodeSerializer& operator=(const CodeSerializer&) = delete;
   V8_EXPORT_PRIVATE static ScriptCompiler::CachedData* Serialize(
@@ -57,6 +62,24 @@ class CodeSerializer : public Serializer {
       Isolate* isolate, ScriptData* cached_data, Handle<String> source,
       ScriptOriginOptions origin_options);
 
+  // Deserializes |cached_data| on a background thread. Everything that needs
+  // the source, or the main thread, is left to FinishOffThreadDeserialize.
+  V8_WARN_UNUSED_RESULT static OffThreadDeserializeData
+  StartDeserializeOffThread(LocalIsolate* isolate, ScriptData* cached_data);
+
+  V8_WARN_UNUSED_RESULT static MaybeHandle<SharedFunctionInfo>
+  FinishOffThreadDeserialize(Isolate* isolate, OffThreadDeserializeData&& data,
+                             ScriptData* cached_data, Handle<String> source,
+                             ScriptOriginOptions origin_options);
+
+  // Deserializes |cached_data|, which must have been produced for the source
+  // of |script|, and installs the bytecode of every function compiled in it
+  // into the matching function of |script| that is still lazy there. Nothing
+  // is recompiled. Returns false if the data was rejected.
+  V8_EXPORT_PRIVATE static bool MergeIntoScript(Isolate* isolate,
+                                                ScriptData* cached_data,
+                                                Handle<Script> script);
+
   uint32_t source_hash() const { return source_hash_; }
 
  protected:
@@ -109,6 +132,10 @@ class SerializedCodeData : public SerializedData {
   static SerializedCodeData FromCachedData(ScriptData* cached_data,
                                            uint32_t expected_source_hash,
                                            SanityCheckResult* rejection_result);
+  // For consuming off-thread, before the source is known. The source hash is
+  // checked separately, by SanityCheckJustSource.
+  static SerializedCodeData FromCachedDataWithoutSource(
+      ScriptData* cached_data, SanityCheckResult* rejection_result);
 
   // Used when producing.
   SerializedCodeData(const std::vector<byte>* payload,
@@ -132,6 +159,20 @@ class SerializedCodeData : public SerializedData {
   }
 
   SanityCheckResult SanityCheck(uint32_t expected_source_hash) const;
+  SanityCheckResult SanityCheckJustSource(uint32_t expected_source_hash) const;
+  SanityCheckResult SanityCheckWithoutSource() const;
+
+  friend class CodeSerializer;
+};
+
+struct CodeSerializer::OffThreadDeserializeData {
+ private:
+  friend class CodeSerializer;
+  SerializedCodeData::SanityCheckResult sanity_check_result =
+      SerializedCodeData::CHECK_SUCCESS;
+  MaybeHandle<SharedFunctionInfo> maybe_result;
+  std::vector<Handle<Script>> scripts;
+  std::unique_ptr<PersistentHandles> persistent_handles;
 };
 
 }  // namespace internal
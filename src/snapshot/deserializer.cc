@@ -10,9 +10,12 @@
 #include "src/common/external-pointer.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
+#include "src/execution/local-isolate.h"
+#include "src/handles/local-handles-inl.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier-inl.h"
 #include "src/heap/heap-write-barrier.h"
+#include "src/heap/local-heap-inl.h"
 #include "src/heap/read-only-heap.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/log.h"
@@ -151,8 +154,8 @@ class SlotAccessorForRootSlots {
 // a Handle already exists.
 class SlotAccessorForHandle {
  public:
-  SlotAccessorForHandle(Handle<HeapObject>* handle, Isolate* isolate)
-      : handle_(handle), isolate_(isolate) {}
+  SlotAccessorForHandle(Handle<HeapObject>* handle, Deserializer* deserializer)
+      : handle_(handle), deserializer_(deserializer) {}
 
   MaybeObjectSlot slot() const { UNREACHABLE(); }
   Handle<HeapObject> object() const { UNREACHABLE(); }
@@ -163,7 +166,7 @@ class SlotAccessorForHandle {
             int slot_offset = 0) {
     DCHECK_EQ(slot_offset, 0);
     DCHECK_EQ(ref_type, HeapObjectReferenceType::STRONG);
-    *handle_ = handle(value, isolate_);
+    *handle_ = deserializer_->NewHandle(value);
     return 1;
   }
   int Write(Handle<HeapObject> value, HeapObjectReferenceType ref_type,
@@ -185,7 +188,7 @@ class SlotAccessorForHandle {
 
  private:
   Handle<HeapObject>* handle_;
-  Isolate* isolate_;
+  Deserializer* deserializer_;
 };
 
 template <typename TSlot>
@@ -239,6 +242,19 @@ Deserializer::Deserializer(Isolate* isolate, Vector<const byte> payload,
   CHECK_EQ(magic_number_, SerializedData::kMagicNumber);
 }
 
+Deserializer::Deserializer(LocalIsolate* local_isolate,
+                           Vector<const byte> payload, uint32_t magic_number)
+    : Deserializer(local_isolate->GetMainThreadIsolateUnsafe(), payload,
+                   magic_number, true, false) {
+  local_isolate_ = local_isolate;
+}
+
+template <typename T>
+Handle<T> Deserializer::NewHandle(T object) {
+  if (local_isolate_ != nullptr) return handle(object, local_isolate_);
+  return handle(object, isolate());
+}
+
 void Deserializer::Rehash() {
   DCHECK(can_rehash() || deserializing_user_code());
   for (Handle<HeapObject> item : to_rehash_) {
@@ -319,6 +335,10 @@ Handle<String> StringTableInsertionKey::AsHandle(Isolate* isolate) {
   return string_;
 }
 
+Handle<String> StringTableInsertionKey::AsHandle(LocalIsolate* isolate) {
+  return string_;
+}
+
 uint32_t StringTableInsertionKey::ComputeHashField(String string) {
   // Make sure hash_field() is computed.
   string.Hash();
@@ -354,10 +374,14 @@ void Deserializer::PostProcessNewObject(Handle<Map> map, Handle<HeapObject> obj,
 
       StringTableInsertionKey key(string);
       Handle<String> result =
-          isolate()->string_table()->LookupKey(isolate(), &key);
+          local_isolate_ != nullptr
+              ? isolate()->string_table()->LookupKey(local_isolate_, &key)
+              : isolate()->string_table()->LookupKey(isolate(), &key);
 
       if (FLAG_thin_strings && *result != *string) {
-        string->MakeThin(isolate(), *result);
+        // Off-thread, nothing but |obj| refers to the duplicate yet, so it is
+        // simply dropped instead of being turned into a ThinString.
+        if (local_isolate_ == nullptr) string->MakeThin(isolate(), *result);
         // Mutate the given object handle so that the backreference entry is
         // also updated.
         obj.PatchValue(*result);
@@ -377,7 +401,8 @@ void Deserializer::PostProcessNewObject(Handle<Map> map, Handle<HeapObject> obj,
   }
 
   if (InstanceTypeChecker::IsScript(instance_type)) {
-    LogScriptEvents(Script::cast(*obj));
+    // Off-thread, scripts are logged once they are attached to the isolate.
+    if (local_isolate_ == nullptr) LogScriptEvents(Script::cast(*obj));
   } else if (InstanceTypeChecker::IsCode(instance_type)) {
     // We flush all code pages after deserializing the startup snapshot.
     // Hence we only remember each individual code object when deserializing
@@ -493,7 +518,7 @@ Handle<HeapObject> Deserializer::GetBackReferencedObject() {
 Handle<HeapObject> Deserializer::ReadObject() {
   Handle<HeapObject> ret;
   CHECK_EQ(ReadSingleBytecodeData(source_.Get(),
-                                  SlotAccessorForHandle(&ret, isolate())),
+                                  SlotAccessorForHandle(&ret, this)),
            1);
   return ret;
 }
@@ -562,7 +587,7 @@ Handle<HeapObject> Deserializer::ReadObject(SnapshotSpace space) {
   }
 #endif
 
-  Handle<HeapObject> obj = handle(raw_obj, isolate());
+  Handle<HeapObject> obj = NewHandle(raw_obj);
   back_refs_.push_back(obj);
 
   ReadData(obj, 1, size_in_tagged);
@@ -592,7 +617,7 @@ Handle<HeapObject> Deserializer::ReadMetaMap() {
   MemsetTagged(raw_obj.RawField(kTaggedSize), uninitialized_field_value(),
                size_in_tagged - 1);
 
-  Handle<HeapObject> obj = handle(raw_obj, isolate());
+  Handle<HeapObject> obj = NewHandle(raw_obj);
   back_refs_.push_back(obj);
 
   // Set the instance-type manually, to allow backrefs to read it.
@@ -1140,11 +1165,18 @@ HeapObject Deserializer::Allocate(SnapshotSpace space, int size,
   }
 #endif
 
-  HeapObject obj = isolate()->heap()->AllocateRawWith<Heap::kRetryOrFail>(
-      size, SpaceToType(space), AllocationOrigin::kRuntime, alignment);
+  HeapObject obj;
+  if (local_isolate_ != nullptr) {
+    DCHECK_EQ(space, SnapshotSpace::kOld);
+    obj = HeapObject::FromAddress(local_isolate_->heap()->AllocateRawOrFail(
+        size, SpaceToType(space), AllocationOrigin::kRuntime, alignment));
+  } else {
+    obj = isolate()->heap()->AllocateRawWith<Heap::kRetryOrFail>(
+        size, SpaceToType(space), AllocationOrigin::kRuntime, alignment);
+  }
 
 #ifdef DEBUG
-  previous_allocation_obj_ = handle(obj, isolate());
+  previous_allocation_obj_ = NewHandle(obj);
   previous_allocation_size_ = size;
 #endif
 
@@ -63,6 +63,10 @@ class V8_EXPORT_PRIVATE Deserializer : public SerializerDeserializer {
   Deserializer(Isolate* isolate, Vector<const byte> payload,
                uint32_t magic_number, bool deserializing_user_code,
                bool can_rehash);
+  // Create a deserializer for user code that runs on a background thread and
+  // allocates on that thread's LocalHeap.
+  Deserializer(LocalIsolate* local_isolate, Vector<const byte> payload,
+               uint32_t magic_number);
 
   void DeserializeDeferredObjects();
 
@@ -91,6 +95,8 @@ class V8_EXPORT_PRIVATE Deserializer : public SerializerDeserializer {
   }
 
   Isolate* isolate() const { return isolate_; }
+  // The background thread's isolate when deserializing off-thread, or null.
+  LocalIsolate* local_isolate() const { return local_isolate_; }
 
   SnapshotByteSource* source() { return &source_; }
   const std::vector<Handle<AllocationSite>>& new_allocation_sites() const {
@@ -131,6 +137,7 @@ class V8_EXPORT_PRIVATE Deserializer : public SerializerDeserializer {
   Handle<HeapObject> ReadObject();
 
  private:
+  friend class SlotAccessorForHandle;
   class RelocInfoVisitor;
   // A circular queue of hot objects. This is added to in the same order as in
   // Serializer::HotObjectsList, but this stores the objects as a vector of
@@ -206,8 +213,13 @@ class V8_EXPORT_PRIVATE Deserializer : public SerializerDeserializer {
   HeapObject Allocate(SnapshotSpace space, int size,
                       AllocationAlignment alignment);
 
+  // Creates a handle on the thread this deserializer runs on.
+  template <typename T>
+  Handle<T> NewHandle(T object);
+
   // Cached current isolate.
   Isolate* isolate_;
+  LocalIsolate* local_isolate_ = nullptr;
 
   // Objects from the attached object descriptions in the serialized user code.
   std::vector<Handle<HeapObject>> attached_objects_;
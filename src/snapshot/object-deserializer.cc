@@ -6,6 +6,7 @@
 
 #include "src/codegen/assembler-inl.h"
 #include "src/execution/isolate.h"
+#include "src/execution/local-isolate.h"
 #include "src/heap/heap-inl.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/objects.h"
@@ -20,6 +21,10 @@ ObjectDeserializer::ObjectDeserializer(Isolate* isolate,
     : Deserializer(isolate, data->Payload(), data->GetMagicNumber(), true,
                    false) {}
 
+ObjectDeserializer::ObjectDeserializer(LocalIsolate* isolate,
+                                       const SerializedCodeData* data)
+    : Deserializer(isolate, data->Payload(), data->GetMagicNumber()) {}
+
 MaybeHandle<SharedFunctionInfo>
 ObjectDeserializer::DeserializeSharedFunctionInfo(
     Isolate* isolate, const SerializedCodeData* data, Handle<String> source) {
@@ -36,9 +41,17 @@ ObjectDeserializer::DeserializeSharedFunctionInfo(
 MaybeHandle<SharedFunctionInfo>
 ObjectDeserializer::DeserializeSharedFunctionInfoOffThread(
     LocalIsolate* isolate, const SerializedCodeData* data,
-    Handle<String> source) {
-  // TODO(leszeks): Add LocalHeap support to deserializer
-  UNREACHABLE();
+    std::vector<Handle<Script>>* scripts) {
+  ObjectDeserializer d(isolate, data);
+
+  d.AddAttachedObject(isolate->factory()->empty_string());
+
+  Handle<HeapObject> result;
+  if (!d.DeserializeOffThread().ToHandle(&result)) {
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+  *scripts = d.new_scripts();
+  return Handle<SharedFunctionInfo>::cast(result);
 }
 
 MaybeHandle<HeapObject> ObjectDeserializer::Deserialize() {
@@ -59,6 +72,28 @@ MaybeHandle<HeapObject> ObjectDeserializer::Deserialize() {
   return scope.CloseAndEscape(result);
 }
 
+MaybeHandle<HeapObject> ObjectDeserializer::DeserializeOffThread() {
+  DCHECK(deserializing_user_code());
+  DCHECK_NOT_NULL(local_isolate());
+  Handle<HeapObject> result = ReadObject();
+  DeserializeDeferredObjects();
+  // Code caches do not contain any of the objects that need to be linked
+  // into main-thread heap state.
+  CHECK(new_code_objects().empty());
+  CHECK(new_allocation_sites().empty());
+  CHECK(new_maps().empty());
+  CHECK(new_descriptor_arrays().empty());
+  CheckNoArrayBufferBackingStores();
+
+  // Rehashing dictionaries only reads the read-only roots.
+  Rehash();
+  for (Handle<Script> script : new_scripts()) {
+    // Assign a new script id to avoid collision.
+    script->set_id(local_isolate()->GetNextScriptId());
+  }
+  return result;
+}
+
 void ObjectDeserializer::CommitPostProcessedObjects() {
   for (Handle<JSArrayBuffer> buffer : new_off_heap_array_buffers()) {
     uint32_t store_index = buffer->GetBackingStoreRefForDeserialization();
@@ -18,15 +18,20 @@ class ObjectDeserializer final : public Deserializer {
  public:
   static MaybeHandle<SharedFunctionInfo> DeserializeSharedFunctionInfo(
       Isolate* isolate, const SerializedCodeData* data, Handle<String> source);
+  // Deserializes on a background thread. The result refers to an empty
+  // source string, and the deserialized scripts, returned in |scripts|, still
+  // have to be attached to the isolate on the main thread.
   static MaybeHandle<SharedFunctionInfo> DeserializeSharedFunctionInfoOffThread(
       LocalIsolate* isolate, const SerializedCodeData* data,
-      Handle<String> source);
+      std::vector<Handle<Script>>* scripts);
 
  private:
   explicit ObjectDeserializer(Isolate* isolate, const SerializedCodeData* data);
+  ObjectDeserializer(LocalIsolate* isolate, const SerializedCodeData* data);
 
   // Deserialize an object graph. Fail gracefully.
   MaybeHandle<HeapObject> Deserialize();
+  MaybeHandle<HeapObject> DeserializeOffThread();
 
   void LinkAllocationSites();
   void CommitPostProcessedObjects();
@@ -9,6 +9,8 @@
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/sanitizer/asan.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -64,7 +66,120 @@ std::unique_ptr<v8::base::BoundedPageAllocator> CreateBoundedAllocator(
 
 }  // namespace
 
-AccountingAllocator::AccountingAllocator() {
+// Recently returned segments are kept in a small cache so that the next zone
+// can reuse them without going to malloc() (or to the bounded page allocator
+// for compressed zones). Compile jobs on different threads would contend on a
+// single cache, so it is split into shards that threads are assigned to round
+// robin. Only a few common segment sizes are cached, and each shard holds at
+// most kMaxBytesPerShard bytes. Cached segments still count towards the
+// allocator's current memory usage.
+class AccountingAllocator::SegmentCache {
+ public:
+  // Zones mostly allocate segments between 8 KB and 32 KB (see
+  // Zone::NewExpand()). Requests in that range are rounded up to a power of
+  // two so that segments are interchangeable. Compressed segments are always a
+  // multiple of kZonePageSize, and only single-page ones are cached.
+  static constexpr size_t kMinCachedSize = 8 * KB;
+  static constexpr size_t kMaxCachedSize = 32 * KB;
+  static constexpr int kUncompressedClasses = 3;
+  static constexpr int kCompressedClass = kUncompressedClasses;
+  static constexpr int kNumClasses = kUncompressedClasses + 1;
+  static constexpr int kNoClass = -1;
+
+  static constexpr int kNumShards = 8;
+  static constexpr size_t kMaxBytesPerShard = 256 * KB;
+
+  ~SegmentCache() {
+    for (const Shard& shard : shards_) {
+      for (Segment* head : shard.heads) DCHECK_NULL(head);
+    }
+  }
+
+  // Returns the size class for a request of {bytes}, and rounds {bytes} up to
+  // the class size.
+  static int SizeClassFor(size_t* bytes, bool supports_compression) {
+    if (supports_compression) {
+      return *bytes == kZonePageSize ? kCompressedClass : kNoClass;
+    }
+    if (*bytes < kMinCachedSize || *bytes > kMaxCachedSize) return kNoClass;
+    size_t size = kMinCachedSize;
+    int size_class = 0;
+    while (size < *bytes) {
+      size <<= 1;
+      size_class++;
+    }
+    DCHECK_LT(size_class, kUncompressedClasses);
+    *bytes = size;
+    return size_class;
+  }
+
+  Segment* Get(int size_class) {
+    Shard& shard = CurrentShard();
+    base::MutexGuard guard(&shard.mutex);
+    Segment* segment = shard.heads[size_class];
+    if (segment == nullptr) return nullptr;
+    ASAN_UNPOISON_MEMORY_REGION(segment, sizeof(Segment));
+    shard.heads[size_class] = segment->next();
+    shard.size -= segment->total_size();
+    ASAN_UNPOISON_MEMORY_REGION(reinterpret_cast<void*>(segment->start()),
+                                segment->capacity());
+    segment->set_next(nullptr);
+    return segment;
+  }
+
+  bool Put(Segment* segment, int size_class) {
+    Shard& shard = CurrentShard();
+    base::MutexGuard guard(&shard.mutex);
+    if (shard.size + segment->total_size() > kMaxBytesPerShard) return false;
+    shard.size += segment->total_size();
+    segment->set_zone(nullptr);
+    segment->set_next(shard.heads[size_class]);
+    shard.heads[size_class] = segment;
+    ASAN_POISON_MEMORY_REGION(segment, segment->total_size());
+    return true;
+  }
+
+  // Empties all shards, calling {free_segment} for every segment that was
+  // cached.
+  template <typename Callback>
+  void Clear(Callback free_segment) {
+    for (Shard& shard : shards_) {
+      base::MutexGuard guard(&shard.mutex);
+      for (int i = 0; i < kNumClasses; i++) {
+        Segment* segment = shard.heads[i];
+        while (segment != nullptr) {
+          ASAN_UNPOISON_MEMORY_REGION(segment, segment->total_size());
+          Segment* next = segment->next();
+          free_segment(segment, i == kCompressedClass);
+          segment = next;
+        }
+        shard.heads[i] = nullptr;
+      }
+      shard.size = 0;
+    }
+  }
+
+ private:
+  struct Shard {
+    base::Mutex mutex;
+    Segment* heads[kNumClasses] = {};
+    size_t size = 0;
+  };
+
+  Shard& CurrentShard() {
+    static std::atomic<int> next_shard{0};
+    static thread_local int shard = -1;
+    if (V8_UNLIKELY(shard < 0)) {
+      shard = next_shard.fetch_add(1, std::memory_order_relaxed) % kNumShards;
+    }
+    return shards_[shard];
+  }
+
+  Shard shards_[kNumShards];
+};
+
+AccountingAllocator::AccountingAllocator()
+    : segment_cache_(std::make_unique<SegmentCache>()) {
   if (COMPRESS_ZONES_BOOL) {
     v8::PageAllocator* platform_page_allocator = GetPlatformPageAllocator();
     VirtualMemory memory = ReserveAddressSpace(platform_page_allocator);
@@ -74,13 +189,31 @@ AccountingAllocator::AccountingAllocator() {
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleaseCachedSegments(); }
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
-  void* memory;
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     bytes = RoundUp(bytes, kZonePageSize);
+  }
+  int size_class = SegmentCache::SizeClassFor(
+      &bytes, COMPRESS_ZONES_BOOL && supports_compression);
+  if (size_class != SegmentCache::kNoClass) {
+    Segment* segment = segment_cache_->Get(size_class);
+    if (segment != nullptr) {
+      DCHECK_EQ(bytes, segment->total_size());
+      cached_segment_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+      return segment;
+    }
+  }
+  return AllocateSegmentUncached(bytes, supports_compression);
+}
+
+Segment* AccountingAllocator::AllocateSegmentUncached(
+    size_t bytes, bool supports_compression) {
+  void* memory;
+  if (COMPRESS_ZONES_BOOL && supports_compression) {
+    DCHECK(IsAligned(bytes, kZonePageSize));
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
@@ -104,6 +237,20 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
                                         bool supports_compression) {
   segment->ZapContents();
   size_t segment_size = segment->total_size();
+  size_t size = segment_size;
+  int size_class = SegmentCache::SizeClassFor(
+      &size, COMPRESS_ZONES_BOOL && supports_compression);
+  if (size_class != SegmentCache::kNoClass && size == segment_size &&
+      segment_cache_->Put(segment, size_class)) {
+    cached_segment_bytes_.fetch_add(segment_size, std::memory_order_relaxed);
+    return;
+  }
+  FreeSegment(segment, supports_compression);
+}
+
+void AccountingAllocator::FreeSegment(Segment* segment,
+                                      bool supports_compression) {
+  size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
   segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
@@ -113,5 +260,13 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   }
 }
 
+void AccountingAllocator::ReleaseCachedSegments() {
+  segment_cache_->Clear([this](Segment* segment, bool supports_compression) {
+    cached_segment_bytes_.fetch_sub(segment->total_size(),
+                                    std::memory_order_relaxed);
+    FreeSegment(segment, supports_compression);
+  });
+}
+
 }  // namespace internal
 }  // namespace v8
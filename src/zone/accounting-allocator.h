@@ -35,6 +35,13 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   // them if the pool is already full or memory pressure is high.
   void ReturnSegment(Segment* memory, bool supports_compression);
 
+  // Frees all segments held in the segment cache, e.g. on memory pressure.
+  void ReleaseCachedSegments();
+
+  size_t GetCachedSegmentBytes() const {
+    return cached_segment_bytes_.load(std::memory_order_relaxed);
+  }
+
   size_t GetCurrentMemoryUsage() const {
     return current_memory_usage_.load(std::memory_order_relaxed);
   }
@@ -64,8 +71,17 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  class SegmentCache;
+
+  Segment* AllocateSegmentUncached(size_t bytes, bool supports_compression);
+  void FreeSegment(Segment* segment, bool supports_compression);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
+  // Part of {current_memory_usage_} that is held in the segment cache.
+  std::atomic<size_t> cached_segment_bytes_{0};
+
+  std::unique_ptr<SegmentCache> segment_cache_;
 
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
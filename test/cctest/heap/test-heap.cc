@@ -1142,6 +1142,93 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushingOldAge) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_bytecode_old_age = 1;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    {
+      v8::HandleScope scope(isolate);
+      CompileRun("function foo() { return 42; }; foo()");
+    }
+
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+    Handle<JSFunction> function = Handle<JSFunction>::cast(
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked());
+    CHECK(function->shared().is_compiled());
+
+    // The first GC ages the bytecode, the second one flushes it.
+    CcTest::CollectAllGarbage();
+    CHECK(function->shared().is_compiled());
+    CcTest::CollectAllGarbage();
+    CHECK(!function->shared().is_compiled());
+
+    CompileRun("foo()");
+    CHECK(function->shared().is_compiled());
+  }
+}
+
+TEST(TestBytecodeFlushingResetsUnreachableFeedbackVector) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_bytecode_old_age = 1;
+  i::FLAG_lazy_feedback_allocation = false;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    Handle<FeedbackCell> cell;
+    {
+      HandleScope scope(i_isolate);
+      CompileRun(
+          "function outer() { return function inner() { return 42; }; }"
+          "var f = outer();"
+          "f();");
+      Handle<String> f_name = factory->InternalizeUtf8String("f");
+      Handle<JSFunction> inner = Handle<JSFunction>::cast(
+          Object::GetProperty(i_isolate, i_isolate->global_object(), f_name)
+              .ToHandleChecked());
+      CHECK(inner->shared().is_compiled());
+      CHECK(inner->raw_feedback_cell().value().IsFeedbackVector());
+      cell = scope.CloseAndEscape(
+          handle(inner->raw_feedback_cell(), i_isolate));
+    }
+    CompileRun("f = undefined;");
+    Handle<SharedFunctionInfo> shared(
+        FeedbackVector::cast(cell->value()).shared_function_info(), i_isolate);
+
+    // No closure of inner is left to reset the feedback cell, so the GC has
+    // to drop the feedback vector itself once the bytecode is gone.
+    for (int i = 0; i < 3; i++) {
+      CcTest::CollectAllGarbage();
+    }
+    CHECK(!shared->is_compiled());
+    CHECK(cell->value().IsClosureFeedbackCellArray());
+  }
+}
+
 HEAP_TEST(Regress10560) {
   i::FLAG_flush_bytecode = true;
   i::FLAG_allow_natives_syntax = true;
@@ -5,6 +5,7 @@
 // Tests v8::internal::Scanner. Note that presently most unit tests for the
 // Scanner are in cctest/test-parsing.cc, rather than here.
 
+#include "src/ast/ast-value-factory.h"
 #include "src/handles/handles-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
@@ -105,5 +106,67 @@ TEST(AllThePushbacks) {
   }
 }
 
+TEST(LongPlainRuns) {
+  // Identifiers, string literals, comments and whitespace are skipped in
+  // vector-sized chunks where possible. Check lengths around the vector width
+  // with a character that ends the chunk at every position.
+  Isolate* isolate = CcTest::i_isolate();
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  AstValueFactory ast_value_factory(&zone, isolate->ast_string_constants(),
+                                    HashSeed(isolate));
+  for (int length = 1; length < 40; length++) {
+    for (int i = 0; i < length; i++) {
+      std::string identifier(length, 'a');
+      identifier[i] = "Z$_9"[i % 4];
+      if (i == 0) identifier[i] = 'b';
+      std::string string_contents(length, 's');
+      string_contents[i] = '"';
+      std::string comment(length, 'c');
+      comment[i] = '*';
+      std::string spaces(length, ' ');
+      spaces[i] = '\t';
+
+      std::string src = spaces + identifier + " '" + string_contents +
+                        "' /*" + comment + "*/ //" + comment + "\nreturn";
+      auto scanner = make_scanner(src.c_str());
+      CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+      CHECK_EQ(static_cast<int>(spaces.length()),
+               scanner->location().beg_pos);
+      CHECK(scanner->CurrentSymbol(&ast_value_factory)
+                ->IsOneByteEqualTo(identifier.c_str()));
+      CHECK_TOK(Token::STRING, scanner->Next());
+      CHECK(scanner->CurrentSymbol(&ast_value_factory)
+                ->IsOneByteEqualTo(string_contents.c_str()));
+      CHECK(scanner->HasLineTerminatorBeforeNext());
+      CHECK_TOK(Token::RETURN, scanner->Next());
+      CHECK_TOK(Token::EOS, scanner->Next());
+    }
+  }
+}
+
+TEST(LongPlainRunsEndedByNonAscii) {
+  // Non-ASCII characters end vectorized runs and are handled one by one.
+  const uint16_t kNonAscii = 0x00E9;
+  for (int length = 1; length < 24; length++) {
+    for (int i = 0; i < length; i++) {
+      std::vector<uint16_t> src;
+      src.push_back('\'');
+      for (int j = 0; j < length; j++) src.push_back(j == i ? kNonAscii : 's');
+      src.push_back('\'');
+      src.push_back(' ');
+      for (int j = 0; j < length; j++) src.push_back(j == i ? kNonAscii : 'v');
+      auto stream = ScannerStream::ForTesting(src.data(), src.size());
+      Scanner scanner(stream.get(),
+                      UnoptimizedCompileFlags::ForTest(CcTest::i_isolate()));
+      scanner.Initialize();
+      CHECK_TOK(Token::STRING, scanner.Next());
+      CHECK_EQ(length + 2, scanner.location().length());
+      CHECK_TOK(Token::IDENTIFIER, scanner.Next());
+      CHECK_EQ(length, scanner.location().length());
+      CHECK_TOK(Token::EOS, scanner.Next());
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -135,6 +135,41 @@ TEST(AccountingAllocatorCurrentAndMax) {
   CHECK(!platform.oom_callback_called);
 }
 
+TEST(AccountingAllocatorSegmentCache) {
+  AllocationPlatform platform;
+  v8::internal::AccountingAllocator allocator;
+  const bool support_compression = false;
+  const size_t kSegmentSize = 8 * v8::internal::KB;
+
+  v8::internal::Segment* segment =
+      allocator.AllocateSegment(kSegmentSize, support_compression);
+  CHECK_NOT_NULL(segment);
+  CHECK_EQ(kSegmentSize, allocator.GetCurrentMemoryUsage());
+  allocator.ReturnSegment(segment, support_compression);
+  // The segment is kept for reuse and still counts as allocated.
+  CHECK_EQ(kSegmentSize, allocator.GetCachedSegmentBytes());
+  CHECK_EQ(kSegmentSize, allocator.GetCurrentMemoryUsage());
+
+  v8::internal::Segment* reused =
+      allocator.AllocateSegment(kSegmentSize, support_compression);
+  CHECK_EQ(segment, reused);
+  CHECK_EQ(0, allocator.GetCachedSegmentBytes());
+  CHECK_EQ(kSegmentSize, allocator.GetMaxMemoryUsage());
+
+  // Sizes between the cached ones are rounded up.
+  v8::internal::Segment* rounded =
+      allocator.AllocateSegment(kSegmentSize + 1, support_compression);
+  CHECK_EQ(2 * kSegmentSize, rounded->total_size());
+
+  allocator.ReturnSegment(reused, support_compression);
+  allocator.ReturnSegment(rounded, support_compression);
+  CHECK_EQ(3 * kSegmentSize, allocator.GetCachedSegmentBytes());
+  allocator.ReleaseCachedSegments();
+  CHECK_EQ(0, allocator.GetCachedSegmentBytes());
+  CHECK_EQ(0, allocator.GetCurrentMemoryUsage());
+  CHECK(!platform.oom_callback_called);
+}
+
 TEST(MallocedOperatorNewOOM) {
   AllocationPlatform platform;
   CHECK(!platform.oom_callback_called);
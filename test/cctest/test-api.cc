@@ -17536,6 +17536,28 @@ THREADED_TEST(FunctionGetScriptId) {
   CHECK_EQ(script->GetUnboundScript()->GetId(), bar->ScriptId());
 }
 
+TEST(FunctionGetDeoptimizationCount) {
+  if (i::FLAG_jitless || !i::FLAG_opt || i::FLAG_always_opt) return;
+  if (i::FLAG_turboprop) return;
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::Local<v8::Function> foo = v8::Local<v8::Function>::Cast(CompileRun(
+      "function foo(o) { return o.x; }"
+      "foo;"));
+  CHECK_EQ(0, foo->GetDeoptimizationCount());
+  CHECK_NULL(foo->GetLastDeoptimizationReason());
+
+  CompileRun(
+      "%PrepareFunctionForOptimization(foo);"
+      "foo({x: 1});"
+      "%OptimizeFunctionOnNextCall(foo);"
+      "foo({x: 1});"
+      "foo({y: 0, x: 2});");
+  CHECK_EQ(1, foo->GetDeoptimizationCount());
+  CHECK_EQ(0, strcmp(foo->GetLastDeoptimizationReason(), "wrong map"));
+}
+
 
 THREADED_TEST(FunctionGetBoundFunction) {
   LocalContext env;
@@ -28482,6 +28504,303 @@ TEST(FastApiCalls) {
 #endif  // V8_LITE_MODE
 }
 
+#ifndef V8_LITE_MODE
+namespace {
+
+enum class SequenceCallKind {
+  kNone,
+  kTypedArray,
+  kOneByteString,
+  kOneInt,
+  kTwoInts
+};
+
+struct SequenceApiChecker {
+  static SequenceApiChecker* Unwrap(v8::ApiObject receiver) {
+    v8::Object* receiver_obj = reinterpret_cast<v8::Object*>(&receiver);
+    CHECK(IsValidUnwrapObject(receiver_obj));
+    return GetInternalField<SequenceApiChecker, kV8WrapperObjectIndex>(
+        receiver_obj);
+  }
+
+  static void FastTypedArray(v8::ApiObject receiver,
+                             const v8::FastApiTypedArray<int32_t>& array,
+                             v8::FastApiCallbackOptions& options) {
+    SequenceApiChecker* checker = Unwrap(receiver);
+    checker->result_ |= ApiCheckerResult::kFastCalled;
+    checker->kind_ = SequenceCallKind::kTypedArray;
+    int32_t sum = 0;
+    for (size_t i = 0; i < array.length; ++i) sum += array.data[i];
+    checker->value_ = sum;
+  }
+
+  static void FastOneByteString(v8::ApiObject receiver,
+                                const v8::FastOneByteString& string,
+                                v8::FastApiCallbackOptions& options) {
+    SequenceApiChecker* checker = Unwrap(receiver);
+    checker->result_ |= ApiCheckerResult::kFastCalled;
+    checker->kind_ = SequenceCallKind::kOneByteString;
+    checker->string_ = std::string(string.data, string.length);
+  }
+
+  static void FastOneInt(v8::ApiObject receiver, int32_t a,
+                         v8::FastApiCallbackOptions& options) {
+    SequenceApiChecker* checker = Unwrap(receiver);
+    checker->result_ |= ApiCheckerResult::kFastCalled;
+    checker->kind_ = SequenceCallKind::kOneInt;
+    checker->value_ = a;
+  }
+
+  static void FastTwoInts(v8::ApiObject receiver, int32_t a, int32_t b,
+                          v8::FastApiCallbackOptions& options) {
+    SequenceApiChecker* checker = Unwrap(receiver);
+    checker->result_ |= ApiCheckerResult::kFastCalled;
+    checker->kind_ = SequenceCallKind::kTwoInts;
+    checker->value_ = a + b;
+  }
+
+  static void SlowCallback(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Object* receiver_obj = v8::Object::Cast(*info.Holder());
+    SequenceApiChecker* checker =
+        GetInternalField<SequenceApiChecker, kV8WrapperObjectIndex>(
+            receiver_obj);
+    checker->result_ |= ApiCheckerResult::kSlowCalled;
+  }
+
+  void Reset() {
+    result_ = ApiCheckerResult::kNotCalled;
+    kind_ = SequenceCallKind::kNone;
+    value_ = 0;
+    string_.clear();
+  }
+
+  bool DidCallFast() const { return (result_ & ApiCheckerResult::kFastCalled); }
+  bool DidCallSlow() const { return (result_ & ApiCheckerResult::kSlowCalled); }
+
+  ApiCheckerResultFlags result_ = ApiCheckerResult::kNotCalled;
+  SequenceCallKind kind_ = SequenceCallKind::kNone;
+  int32_t value_ = 0;
+  std::string string_;
+};
+
+// Installs `receiver.api_func` backed by {overloads}, warms up and optimizes
+// `func` from {source_code}, then calls it with {argument}.
+void CallOptimizedWithOverloads(
+    LocalContext* env, SequenceApiChecker* checker,
+    const v8::MemorySpan<const v8::CFunction>& overloads,
+    const char* source_code, const char* argument) {
+  v8::Isolate* isolate = CcTest::isolate();
+  Local<v8::FunctionTemplate> checker_templ =
+      v8::FunctionTemplate::NewWithCFunctionOverloads(
+          isolate, SequenceApiChecker::SlowCallback, v8::Local<v8::Value>(),
+          v8::Local<v8::Signature>(), 1, v8::ConstructorBehavior::kAllow,
+          v8::SideEffectType::kHasSideEffect, overloads);
+
+  v8::Local<v8::ObjectTemplate> object_template =
+      v8::ObjectTemplate::New(isolate);
+  object_template->SetInternalFieldCount(kV8WrapperObjectIndex + 1);
+  object_template->Set(isolate, "api_func", checker_templ);
+  v8::Local<v8::Object> object =
+      object_template->NewInstance(env->local()).ToLocalChecked();
+  object->SetAlignedPointerInInternalField(kV8WrapperObjectIndex,
+                                           reinterpret_cast<void*>(checker));
+  CHECK((*env)
+            ->Global()
+            ->Set(env->local(), v8_str("receiver"), object)
+            .FromJust());
+
+  CompileRun(source_code);
+  CompileRun(
+      "%PrepareFunctionForOptimization(func);"
+      "func(value);"
+      "%OptimizeFunctionOnNextCall(func);"
+      "func(value);");
+  checker->Reset();
+  CompileRun((std::string("func(") + argument + ");").c_str());
+}
+
+}  // namespace
+#endif  // V8_LITE_MODE
+
+TEST(FastApiCallsSequencesAndOverloads) {
+#ifndef V8_LITE_MODE
+  if (i::FLAG_jitless) return;
+  if (i::FLAG_turboprop) return;
+
+  FLAG_SCOPE_EXTERNAL(opt);
+  FLAG_SCOPE_EXTERNAL(turbo_fast_api_calls);
+  FLAG_SCOPE_EXTERNAL(allow_natives_syntax);
+  UNFLAG_SCOPE_EXTERNAL(always_opt);
+
+  v8::Isolate* isolate = CcTest::isolate();
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i_isolate->set_embedder_wrapper_type_index(kV8WrapperTypeIndex);
+  i_isolate->set_embedder_wrapper_object_index(kV8WrapperObjectIndex);
+  v8::HandleScope scope(isolate);
+
+  const v8::CFunction typed_array_func = v8::CFunction::MakeWithFallbackSupport(
+      SequenceApiChecker::FastTypedArray);
+  const v8::CFunction string_func = v8::CFunction::MakeWithFallbackSupport(
+      SequenceApiChecker::FastOneByteString);
+  const v8::CFunction one_int_func =
+      v8::CFunction::MakeWithFallbackSupport(SequenceApiChecker::FastOneInt);
+  const v8::CFunction two_ints_func =
+      v8::CFunction::MakeWithFallbackSupport(SequenceApiChecker::FastTwoInts);
+  CHECK_EQ(typed_array_func.ArgumentInfo(1).GetSequenceType(),
+           v8::CTypeInfo::SequenceType::kIsTypedArray);
+  CHECK_EQ(typed_array_func.ArgumentInfo(1).GetType(),
+           v8::CTypeInfo::Type::kInt32);
+  CHECK_EQ(string_func.ArgumentInfo(1).GetSequenceType(),
+           v8::CTypeInfo::SequenceType::kIsOneByteString);
+
+  const char* kCallWithArgument =
+      "var value = new Int32Array([1, 2, 3]);"
+      "function func(arg) { return receiver.api_func(arg); }";
+
+  {
+    // A matching typed array is passed to the C function as a view.
+    LocalContext env;
+    SequenceApiChecker checker;
+    const v8::CFunction overloads[] = {typed_array_func};
+    CallOptimizedWithOverloads(&env, &checker, {overloads, 1},
+                               kCallWithArgument,
+                               "new Int32Array([10, 20, 30, 40])");
+    CHECK(checker.DidCallFast());
+    CHECK(!checker.DidCallSlow());
+    CHECK_EQ(checker.value_, 100);
+  }
+
+  {
+    // Typed arrays of another element type take the slow path.
+    LocalContext env;
+    SequenceApiChecker checker;
+    const v8::CFunction overloads[] = {typed_array_func};
+    CallOptimizedWithOverloads(&env, &checker, {overloads, 1},
+                               kCallWithArgument, "new Float64Array(4)");
+    CHECK(!checker.DidCallFast());
+    CHECK(checker.DidCallSlow());
+  }
+
+  {
+    // Detached buffers take the slow path.
+    LocalContext env;
+    SequenceApiChecker checker;
+    const v8::CFunction overloads[] = {typed_array_func};
+    CallOptimizedWithOverloads(
+        &env, &checker, {overloads, 1}, kCallWithArgument,
+        "(() => { let a = new Int32Array(4); %ArrayBufferDetach(a.buffer);"
+        "         return a; })()");
+    CHECK(!checker.DidCallFast());
+    CHECK(checker.DidCallSlow());
+  }
+
+  const char* kCallWithString =
+      "var value = 'warm up';"
+      "function func(arg) { return receiver.api_func(arg); }";
+
+  {
+    // Sequential one-byte strings are passed without copying.
+    LocalContext env;
+    SequenceApiChecker checker;
+    const v8::CFunction overloads[] = {string_func};
+    CallOptimizedWithOverloads(&env, &checker, {overloads, 1},
+                               kCallWithString, "'hello'");
+    CHECK(checker.DidCallFast());
+    CHECK(!checker.DidCallSlow());
+    CHECK_EQ(checker.string_, "hello");
+  }
+
+  {
+    // Two-byte strings take the slow path.
+    LocalContext env;
+    SequenceApiChecker checker;
+    const v8::CFunction overloads[] = {string_func};
+    CallOptimizedWithOverloads(&env, &checker, {overloads, 1},
+                               kCallWithString, "'h\\u1234llo'");
+    CHECK(!checker.DidCallFast());
+    CHECK(checker.DidCallSlow());
+  }
+
+  {
+    // With several overloads, the one matching the arity of the call site is
+    // picked.
+    LocalContext env;
+    SequenceApiChecker checker;
+    const v8::CFunction overloads[] = {string_func, two_ints_func};
+    CallOptimizedWithOverloads(
+        &env, &checker, {overloads, 2},
+        "var value = 1;"
+        "function func(arg) { return receiver.api_func(arg, 2); }",
+        "40");
+    CHECK(checker.DidCallFast());
+    CHECK(!checker.DidCallSlow());
+    CHECK_EQ(checker.kind_, SequenceCallKind::kTwoInts);
+    CHECK_EQ(checker.value_, 42);
+  }
+
+  {
+    // Overloads of the same arity are told apart by the inferred maps of the
+    // arguments; here the string argument is a constant.
+    LocalContext env;
+    SequenceApiChecker checker;
+    const v8::CFunction overloads[] = {typed_array_func, string_func};
+    CallOptimizedWithOverloads(
+        &env, &checker, {overloads, 2},
+        "var value = 0;"
+        "function func(arg) { return receiver.api_func('constant'); }",
+        "0");
+    CHECK(checker.DidCallFast());
+    CHECK(!checker.DidCallSlow());
+    CHECK_EQ(checker.kind_, SequenceCallKind::kOneByteString);
+    CHECK_EQ(checker.string_, "constant");
+  }
+
+  {
+    // A scalar overload of the same arity doesn't shadow the string overload
+    // listed after it.
+    LocalContext env;
+    SequenceApiChecker checker;
+    const v8::CFunction overloads[] = {one_int_func, string_func};
+    CallOptimizedWithOverloads(
+        &env, &checker, {overloads, 2},
+        "var value = 0;"
+        "function func(arg) { return receiver.api_func('constant'); }",
+        "0");
+    CHECK(checker.DidCallFast());
+    CHECK(!checker.DidCallSlow());
+    CHECK_EQ(checker.kind_, SequenceCallKind::kOneByteString);
+  }
+
+  {
+    // Numbers still pick the scalar overload.
+    LocalContext env;
+    SequenceApiChecker checker;
+    const v8::CFunction overloads[] = {string_func, one_int_func};
+    CallOptimizedWithOverloads(
+        &env, &checker, {overloads, 2},
+        "var value = 0;"
+        "function func(arg) { return receiver.api_func(42); }",
+        "0");
+    CHECK(checker.DidCallFast());
+    CHECK(!checker.DidCallSlow());
+    CHECK_EQ(checker.kind_, SequenceCallKind::kOneInt);
+    CHECK_EQ(checker.value_, 42);
+  }
+
+  {
+    // Without anything known about the argument, none of the overloads of
+    // the same arity is picked.
+    LocalContext env;
+    SequenceApiChecker checker;
+    const v8::CFunction overloads[] = {one_int_func, string_func};
+    CallOptimizedWithOverloads(&env, &checker, {overloads, 2},
+                               kCallWithString, "'hello'");
+    CHECK(!checker.DidCallFast());
+    CHECK(checker.DidCallSlow());
+  }
+#endif  // V8_LITE_MODE
+}
+
 THREADED_TEST(Recorder_GetContext) {
   using v8::Context;
   using v8::Local;
@@ -1108,5 +1108,102 @@ TEST(ProfilerEnabledDuringBackgroundCompile) {
   cpu_profiler->StopProfiling(profile);
 }
 
+namespace {
+
+const char* kCompileHintsSource =
+    "function a() { return 1; }\n"
+    "function b() { return 2; }\n"
+    "function c() { return 3; }\n"
+    "a();\n";
+
+// The position of the parameter list of function |name| in
+// kCompileHintsSource.
+int CompileHintPosition(const char* name) {
+  std::string declaration = std::string("function ") + name + "(";
+  const char* found = strstr(kCompileHintsSource, declaration.c_str());
+  CHECK_NOT_NULL(found);
+  return static_cast<int>(found - kCompileHintsSource) +
+         static_cast<int>(declaration.size()) - 1;
+}
+
+bool CompileHintCallback(int position, void* data) {
+  std::vector<int>* hints = static_cast<std::vector<int>*>(data);
+  return std::find(hints->begin(), hints->end(), position) != hints->end();
+}
+
+}  // namespace
+
+TEST(CompileHints) {
+  i::FLAG_always_opt = false;
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+
+  // Without hints only a() gets compiled, on its call.
+  std::vector<int> hints;
+  {
+    v8::ScriptCompiler::Source source(v8_str(kCompileHintsSource),
+                                      v8::ScriptOrigin(v8_str("hints")));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate, &source)
+            .ToLocalChecked();
+    CHECK(script->GetProducedCompileHints().empty());
+    script->BindToCurrentContext()->Run(env.local()).ToLocalChecked();
+    hints = script->GetProducedCompileHints();
+  }
+  CHECK_EQ(1u, hints.size());
+  CHECK_EQ(CompileHintPosition("a"), hints[0]);
+
+  // Hinted functions are compiled eagerly, without being called. The script
+  // compiled above is in the compilation cache, which has to be bypassed.
+  hints.push_back(CompileHintPosition("c"));
+  v8::ScriptCompiler::Source source(v8_str(kCompileHintsSource),
+                                    v8::ScriptOrigin(v8_str("hints")),
+                                    CompileHintCallback, &hints);
+  v8::Local<v8::UnboundScript> script =
+      v8::ScriptCompiler::CompileUnboundScript(isolate, &source)
+          .ToLocalChecked();
+  CHECK(script->GetProducedCompileHints() == hints);
+  {
+    v8::internal::DisallowCompilation no_compile_expected(CcTest::i_isolate());
+    script->BindToCurrentContext()->Run(env.local()).ToLocalChecked();
+  }
+}
+
+TEST(CompileHintsWithStreaming) {
+  i::FLAG_always_opt = false;
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+
+  // Put the script into the compilation cache without hints first.
+  {
+    v8::ScriptCompiler::Source source(v8_str(kCompileHintsSource),
+                                      v8::ScriptOrigin(v8_str("hints")));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate, &source)
+            .ToLocalChecked();
+    CHECK(script->GetProducedCompileHints().empty());
+  }
+
+  std::vector<int> hints = {CompileHintPosition("b")};
+  v8::ScriptCompiler::StreamedSource streamed_source(
+      std::make_unique<DummySourceStream>(kCompileHintsSource),
+      v8::ScriptCompiler::StreamedSource::UTF8);
+  std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask> task(
+      v8::ScriptCompiler::StartStreaming(isolate, &streamed_source,
+                                         CompileHintCallback, &hints));
+  task->Run();
+
+  v8::Local<v8::Script> script =
+      v8::ScriptCompiler::Compile(env.local(), &streamed_source,
+                                  v8_str(kCompileHintsSource),
+                                  v8::ScriptOrigin(v8_str("hints")))
+          .ToLocalChecked();
+  CHECK(script->GetUnboundScript()->GetProducedCompileHints() == hints);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -60,6 +60,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 #include "test/cctest/setup-isolate-for-tests.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -2387,6 +2388,88 @@ TEST(CodeSerializerIsolates) {
   isolate2->Dispose();
 }
 
+namespace {
+
+class ConsumeCodeCacheThread final : public v8::base::Thread {
+ public:
+  explicit ConsumeCodeCacheThread(
+      v8::ScriptCompiler::ConsumeCodeCacheTask* task)
+      : Thread(base::Thread::Options("ConsumeCodeCacheThread")), task_(task) {}
+
+  void Run() final { task_->Run(); }
+
+ private:
+  v8::ScriptCompiler::ConsumeCodeCacheTask* task_;
+};
+
+// Compiles |source_code| in |isolate| with |cache|, which is taken over,
+// deserialized by a ConsumeCodeCacheTask run on a background thread.
+v8::Local<v8::UnboundScript> CompileWithConsumeCodeCacheTask(
+    v8::Isolate* isolate, const char* source_code,
+    v8::ScriptCompiler::CachedData* cache, bool* rejected) {
+  v8::ScriptCompiler::ConsumeCodeCacheTask* task =
+      v8::ScriptCompiler::StartConsumingCodeCache(
+          isolate, std::make_unique<v8::ScriptCompiler::CachedData>(
+                       cache->data, cache->length));
+  ConsumeCodeCacheThread thread(task);
+  CHECK(thread.Start());
+  thread.Join();
+
+  v8::ScriptOrigin origin(v8_str("test"));
+  v8::ScriptCompiler::Source source(v8_str(source_code), origin, cache, task);
+  v8::Local<v8::UnboundScript> script =
+      v8::ScriptCompiler::CompileUnboundScript(
+          isolate, &source, v8::ScriptCompiler::kConsumeCodeCache)
+          .ToLocalChecked();
+  *rejected = source.GetCachedData()->rejected;
+  return script;
+}
+
+}  // namespace
+
+TEST(CodeSerializerConsumeCodeCacheTask) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+  uint8_t* cache_copy = new uint8_t[cache->length];
+  MemCopy(cache_copy, cache->data, cache->length);
+  v8::ScriptCompiler::CachedData* cache_for_other_source =
+      new v8::ScriptCompiler::CachedData(
+          cache_copy, cache->length,
+          v8::ScriptCompiler::CachedData::BufferOwned);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::UnboundScript> script;
+    bool rejected;
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script =
+          CompileWithConsumeCodeCacheTask(isolate2, source, cache, &rejected);
+    }
+    CHECK(!rejected);
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->Equals(context, v8_str("abcdef")).FromJust());
+
+    // The source is only checked on the main thread. A mismatch rejects the
+    // cache and falls back to compiling.
+    const char* other_source = "function f() { return 'ghi'; }; f() + 'def'";
+    script = CompileWithConsumeCodeCacheTask(
+        isolate2, other_source, cache_for_other_source, &rejected);
+    CHECK(rejected);
+    result = script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->Equals(context, v8_str("ghidef")).FromJust());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerIsolatesEager) {
   const char* source =
       "function f() {"
@@ -2433,6 +2516,297 @@ TEST(CodeSerializerIsolatesEager) {
   isolate2->Dispose();
 }
 
+namespace {
+
+Handle<SharedFunctionInfo> FindSharedFunctionInfo(Isolate* isolate,
+                                                  Handle<Script> script,
+                                                  const char* name) {
+  SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+  for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (info.Name().IsOneByteEqualTo(CStrVector(name))) {
+      return handle(info, isolate);
+    }
+  }
+  return Handle<SharedFunctionInfo>();
+}
+
+}  // namespace
+
+TEST(CodeSerializerLazyFunctionKeepsPreparseData) {
+  // Functions that are still lazy when the cache is produced carry the
+  // preparse data of their inner functions through the cache, so that their
+  // first compile after deserialization can skip those inner functions.
+  const char* source =
+      "function f() {"
+      "  function g() {"
+      "    function h() { return 'abc'; }"
+      "    return h();"
+      "  }"
+      "  return g();"
+      "}"
+      "f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate2);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    Handle<Script> i_script(Script::cast(toplevel->script()), i_isolate);
+    Handle<SharedFunctionInfo> f =
+        FindSharedFunctionInfo(i_isolate, i_script, "f");
+    CHECK(!f.is_null());
+    CHECK(!f->is_compiled());
+    CHECK(f->HasUncompiledDataWithPreparseData());
+
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+    CHECK(f->is_compiled());
+    Handle<SharedFunctionInfo> g =
+        FindSharedFunctionInfo(i_isolate, i_script, "g");
+    CHECK(!g.is_null());
+    CHECK(g->is_compiled());
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
+namespace {
+
+const char* kMergeCodeCacheSource =
+    "function f() { return 'abc'; }"
+    "function g() { return 'def'; }"
+    "function h() {"
+    "  function i() { return 'ghi'; }"
+    "  return i();"
+    "}";
+
+// Compiles and runs kMergeCodeCacheSource in a fresh isolate, runs |call| and
+// returns the code cache produced afterwards.
+v8::ScriptCompiler::CachedData* ProduceCacheAfterCalling(const char* call) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  v8::ScriptCompiler::CachedData* cache;
+  {
+    v8::Isolate::Scope iscope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source(v8_str(kMergeCodeCacheSource));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate, &source)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CompileRun(call);
+    cache = v8::ScriptCompiler::CreateCodeCache(script);
+  }
+  isolate->Dispose();
+  return cache;
+}
+
+}  // namespace
+
+TEST(CodeSerializerMergeCodeCache) {
+  v8::ScriptCompiler::CachedData* base = ProduceCacheAfterCalling("f()");
+  v8::ScriptCompiler::CachedData* update = ProduceCacheAfterCalling("h()");
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+
+    v8::ScriptCompiler::Source source(v8_str(kMergeCodeCacheSource), base);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!base->rejected);
+
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    Handle<Script> i_script(Script::cast(toplevel->script()), i_isolate);
+    CHECK(FindSharedFunctionInfo(i_isolate, i_script, "f")->is_compiled());
+    CHECK(!FindSharedFunctionInfo(i_isolate, i_script, "h")->is_compiled());
+    CHECK(FindSharedFunctionInfo(i_isolate, i_script, "i").is_null());
+
+    // Caches for a different source are rejected.
+    v8::ScriptCompiler::CachedData* other;
+    {
+      v8::ScriptCompiler::Source other_source(v8_str("function f() {}"));
+      other = v8::ScriptCompiler::CreateCodeCache(
+          v8::ScriptCompiler::CompileUnboundScript(isolate, &other_source)
+              .ToLocalChecked());
+    }
+    CHECK(!v8::ScriptCompiler::MergeCodeCache(script, other));
+    CHECK(other->rejected);
+    delete other;
+
+    CHECK(v8::ScriptCompiler::MergeCodeCache(script, update));
+    CHECK(!update->rejected);
+    CHECK(FindSharedFunctionInfo(i_isolate, i_script, "f")->is_compiled());
+    CHECK(FindSharedFunctionInfo(i_isolate, i_script, "h")->is_compiled());
+    CHECK(FindSharedFunctionInfo(i_isolate, i_script, "i")->is_compiled());
+    CHECK(!FindSharedFunctionInfo(i_isolate, i_script, "g")->is_compiled());
+
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(CompileRun("f() + g() + h()")
+              ->Equals(context, v8_str("abcdefghi"))
+              .FromJust());
+
+    // The merged script produces a cache containing both sets of functions.
+    v8::ScriptCompiler::CachedData* merged =
+        v8::ScriptCompiler::CreateCodeCache(script);
+    CHECK_GT(merged->length, base->length);
+    CHECK_GT(merged->length, update->length);
+    delete merged;
+  }
+  isolate->Dispose();
+  delete update;
+}
+
+namespace {
+
+const char* kFeedbackProfileSource =
+    "function hot(o) { return o.x + 1; }"
+    "function cold() { return 0; }"
+    "var r = hot({x: 1}) + cold();";
+
+v8::Local<v8::UnboundScript> CompileAndRunForFeedbackProfile(
+    v8::Isolate* isolate, const char* source_code,
+    v8::ScriptCompiler::CachedData* profile = nullptr) {
+  v8::ScriptOrigin origin(v8_str("test"));
+  v8::ScriptCompiler::Source source(v8_str(source_code), origin);
+  v8::Local<v8::UnboundScript> script =
+      v8::ScriptCompiler::CompileUnboundScript(isolate, &source)
+          .ToLocalChecked();
+  if (profile != nullptr) {
+    v8::ScriptCompiler::PreloadFeedbackProfile(script, profile);
+  }
+  script->BindToCurrentContext()
+      ->Run(isolate->GetCurrentContext())
+      .ToLocalChecked();
+  return script;
+}
+
+Handle<JSFunction> GetGlobalFunction(v8::Isolate* isolate, const char* name) {
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Value> value =
+      context->Global()->Get(context, v8_str(name)).ToLocalChecked();
+  return Handle<JSFunction>::cast(v8::Utils::OpenHandle(*value));
+}
+
+v8::ScriptCompiler::CachedData* ProduceFeedbackProfile(
+    const char* source_code) {
+  v8::ScriptCompiler::CachedData* profile;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::UnboundScript> script =
+        CompileAndRunForFeedbackProfile(isolate1, source_code);
+    GetGlobalFunction(isolate1, "hot")->feedback_vector().set_profiler_ticks(
+        5);
+    profile = v8::ScriptCompiler::CreateFeedbackProfile(script);
+  }
+  isolate1->Dispose();
+  return profile;
+}
+
+}  // namespace
+
+TEST(FeedbackProfileIsolates) {
+  FlagScope<bool> no_lazy_feedback(&FLAG_lazy_feedback_allocation, false);
+  FlagScope<bool> no_always_opt(&FLAG_always_opt, false);
+  v8::ScriptCompiler::CachedData* profile =
+      ProduceFeedbackProfile(kFeedbackProfileSource);
+  CHECK_NOT_NULL(profile);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    CompileAndRunForFeedbackProfile(isolate2, kFeedbackProfileSource, profile);
+    CHECK(!profile->rejected);
+    CHECK_EQ(5, GetGlobalFunction(isolate2, "hot")
+                    ->feedback_vector()
+                    .profiler_ticks());
+    CHECK_EQ(0, GetGlobalFunction(isolate2, "cold")
+                    ->feedback_vector()
+                    .profiler_ticks());
+  }
+  isolate2->Dispose();
+  delete profile;
+}
+
+TEST(FeedbackProfileRejectsOtherSource) {
+  FlagScope<bool> no_lazy_feedback(&FLAG_lazy_feedback_allocation, false);
+  FlagScope<bool> no_always_opt(&FLAG_always_opt, false);
+  v8::ScriptCompiler::CachedData* profile =
+      ProduceFeedbackProfile(kFeedbackProfileSource);
+  CHECK_NOT_NULL(profile);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    // Same length, different contents.
+    CompileAndRunForFeedbackProfile(
+        isolate2,
+        "function hot(o) { return o.y + 1; }"
+        "function cold() { return 0; }"
+        "var r = hot({y: 1}) + cold();",
+        profile);
+    CHECK(profile->rejected);
+    CHECK_EQ(0, GetGlobalFunction(isolate2, "hot")
+                    ->feedback_vector()
+                    .profiler_ticks());
+  }
+  isolate2->Dispose();
+  delete profile;
+}
+
 TEST(CodeSerializerAfterExecute) {
   // We test that no compilations happen when running this code. Forcing
   // to always optimize breaks this test.
@@ -0,0 +1,72 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Counted loops over Float32Array and Float64Array, in the style of audio
+// processing kernels. Only an access to exactly the array named in the loop
+// condition `i < a.length`, at index `i`, has its bounds check removed, e.g.
+// left[i] in Gain and RMS or taps[j] in FIRFilter. The stores to output, the
+// reads of right in Mix and left[i - j] keep their bounds checks, as there is
+// no range analysis or check hoisting yet.
+
+new BenchmarkSuite('AudioKernels', [1000], [
+  new Benchmark('Gain', false, false, 0, Gain, Setup, TearDown),
+  new Benchmark('Mix', false, false, 0, Mix, Setup, TearDown),
+  new Benchmark('FIRFilter', false, false, 0, FIRFilter, Setup, TearDown),
+  new Benchmark('RMS', false, false, 0, RMS, Setup, TearDown),
+]);
+
+const kFrames = 4096;
+let left;
+let right;
+let output;
+let taps;
+let result;
+
+function Setup() {
+  left = new Float32Array(kFrames);
+  right = new Float32Array(kFrames);
+  for (let i = 0; i < kFrames; i++) {
+    left[i] = Math.sin(i / 16);
+    right[i] = Math.cos(i / 32);
+  }
+  output = new Float32Array(kFrames);
+  taps = new Float64Array([0.1, 0.2, 0.4, 0.2, 0.1]);
+}
+
+function Gain() {
+  for (let i = 0; i < left.length; i++) {
+    output[i] = left[i] * 0.5;
+  }
+}
+
+function Mix() {
+  for (let i = 0; i < left.length; i++) {
+    output[i] = left[i] * 0.7 + right[i] * 0.3;
+  }
+}
+
+function FIRFilter() {
+  for (let i = taps.length; i < left.length; i++) {
+    let sum = 0;
+    for (let j = 0; j < taps.length; j++) {
+      sum += left[i - j] * taps[j];
+    }
+    output[i] = sum;
+  }
+}
+
+function RMS() {
+  let sum = 0;
+  for (let i = 0; i < left.length; i++) {
+    sum += left[i] * left[i];
+  }
+  result = Math.sqrt(sum / left.length);
+}
+
+function TearDown() {
+  left = void 0;
+  right = void 0;
+  output = void 0;
+  taps = void 0;
+}
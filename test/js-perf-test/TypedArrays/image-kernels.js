@@ -0,0 +1,71 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Counted loops over typed arrays and packed JSArrays, in the style of
+// per-pixel image processing kernels. Only an access to exactly the array
+// named in the loop condition `i < a.length`, at index `i`, has its bounds
+// check removed: pixels[i] in Brighten and packedPixels[i] in
+// HistogramPacked. Offset indices, other arrays of the same length and
+// strided loops keep their bounds checks, as there is no range analysis or
+// check hoisting yet.
+
+new BenchmarkSuite('ImageKernels', [1000], [
+  new Benchmark('Brighten', false, false, 0, Brighten, Setup, TearDown),
+  new Benchmark('Grayscale', false, false, 0, Grayscale, Setup, TearDown),
+  new Benchmark('BoxBlurRow', false, false, 0, BoxBlurRow, Setup, TearDown),
+  new Benchmark('HistogramPacked', false, false, 0, HistogramPacked, Setup,
+                TearDown),
+]);
+
+const kWidth = 256;
+const kHeight = 64;
+let pixels;
+let output;
+let histogram;
+let packedPixels;
+
+function Setup() {
+  pixels = new Uint8ClampedArray(kWidth * kHeight * 4);
+  for (let i = 0; i < pixels.length; i++) pixels[i] = i & 0xFF;
+  output = new Uint8ClampedArray(pixels.length);
+  histogram = new Int32Array(256);
+  packedPixels = Array.from(pixels);
+}
+
+function Brighten() {
+  for (let i = 0; i < pixels.length; i++) {
+    output[i] = pixels[i] + 16;
+  }
+}
+
+function Grayscale() {
+  for (let i = 0; i < pixels.length; i += 4) {
+    const gray = (pixels[i] * 77 + pixels[i + 1] * 150 + pixels[i + 2] * 29)
+        >> 8;
+    output[i] = gray;
+    output[i + 1] = gray;
+    output[i + 2] = gray;
+    output[i + 3] = pixels[i + 3];
+  }
+}
+
+function BoxBlurRow() {
+  for (let i = 4; i < pixels.length - 4; i++) {
+    output[i] = (pixels[i - 4] + pixels[i] + pixels[i + 4]) / 3;
+  }
+}
+
+function HistogramPacked() {
+  histogram.fill(0);
+  for (let i = 0; i < packedPixels.length; i++) {
+    histogram[packedPixels[i]]++;
+  }
+}
+
+function TearDown() {
+  pixels = void 0;
+  output = void 0;
+  histogram = void 0;
+  packedPixels = void 0;
+}
@@ -32,6 +32,24 @@ function TestAsUintN() {
   assertEquals(BigInt("0xFFFFFFFFFFFFFFFF85"), BigInt.asUintN(72, -123n));
 }
 
+function TestAsIntN() {
+  assertEquals(0n, BigInt.asIntN(64, 0n));
+  assertEquals(0n, BigInt.asIntN(8, 0n));
+  assertEquals(0n, BigInt.asIntN(0, 123n));
+  assertEquals(123n, BigInt.asIntN(64, 123n));
+  assertEquals(-123n, BigInt.asIntN(64, -123n));
+  assertEquals(123n, BigInt.asIntN(8, 123n));
+  assertEquals(-5n, BigInt.asIntN(4, 123n));
+  assertEquals(-1n, BigInt.asIntN(1, 123n));
+  assertEquals(-123n, BigInt.asIntN(8, -123n));
+  assertEquals(5n, BigInt.asIntN(4, -123n));
+  assertEquals(-(2n ** 63n), BigInt.asIntN(64, 2n ** 63n));
+  assertEquals(2n ** 63n - 1n, BigInt.asIntN(64, -(2n ** 63n) - 1n));
+  assertEquals(-1n, BigInt.asIntN(64, 2n ** 64n - 1n));
+  assertEquals(-1n, BigInt.asIntN(32, 2n ** 100n - 1n));
+  assertEquals(123n, BigInt.asIntN(72, 123n));
+}
+
 function TestInt64LoweredOperations() {
   assertEquals(0n, BigInt.asUintN(64, -0n));
   assertEquals(0n, BigInt.asUintN(64, 15n + -15n));
@@ -72,6 +90,40 @@ function TestInt64LoweredOperations() {
   assertEquals(7n, y);
 }
 
+function TestInt64LoweredMultiplyAndBitwise() {
+  assertEquals(42n, BigInt.asUintN(64, 6n * 7n));
+  assertEquals(-42n, BigInt.asIntN(64, -6n * 7n));
+  assertEquals(2n ** 64n - 42n, BigInt.asUintN(64, 6n * -7n));
+  assertEquals(0n, BigInt.asUintN(64, 2n ** 32n * 2n ** 32n));
+  assertEquals(-(2n ** 63n), BigInt.asIntN(64, 2n ** 62n * 2n));
+  assertEquals(6n, BigInt.asUintN(8, (2n ** 100n + 2n) * 3n));
+  assertEquals(8n, BigInt.asUintN(64, 12n & 10n));
+  assertEquals(14n, BigInt.asUintN(64, 12n | 10n));
+  assertEquals(6n, BigInt.asUintN(64, 12n ^ 10n));
+  assertEquals(-2n, BigInt.asIntN(64, -1n ^ 1n));
+  assertEquals(2n ** 64n - 1n, BigInt.asUintN(64, -1n | 5n));
+  assertEquals(4n, BigInt.asIntN(64, -4n & 7n));
+
+  // FNV-1a style hashing stays in the 64-bit range.
+  let hash = 0xcbf29ce484222325n;
+  for (let i = 0n; i < 8n; ++i) {
+    hash = BigInt.asUintN(64, (hash ^ i) * 0x100000001b3n);
+  }
+  assertEquals(0xa4dc49e2b28ecb7dn, hash);
+}
+
+function TestTaggedMultiplyAndBitwise() {
+  assertEquals(42n, 6n * 7n);
+  assertEquals(2n ** 128n, 2n ** 64n * 2n ** 64n);
+  assertEquals(-(2n ** 100n), 2n ** 50n * -(2n ** 50n));
+  assertEquals(8n, 12n & 10n);
+  assertEquals(-16n, -12n & -6n);
+  assertEquals(14n, 12n | 10n);
+  assertEquals(-1n, -(2n ** 70n) | (2n ** 70n - 1n));
+  assertEquals(6n, 12n ^ 10n);
+  assertEquals(2n ** 80n, (2n ** 80n + 1n) ^ 1n);
+}
+
 function OptimizeAndTest(fn) {
   %PrepareFunctionForOptimization(fn);
   %PrepareFunctionForOptimization(assertEquals);
@@ -85,4 +137,7 @@ function OptimizeAndTest(fn) {
 }
 
 OptimizeAndTest(TestAsUintN);
+OptimizeAndTest(TestAsIntN);
 OptimizeAndTest(TestInt64LoweredOperations);
+OptimizeAndTest(TestInt64LoweredMultiplyAndBitwise);
+OptimizeAndTest(TestTaggedMultiplyAndBitwise);
@@ -0,0 +1,34 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+
+// Long enough that multiplying it with itself is too much work to do without
+// checking for interrupts, so optimized code has to deoptimize.
+const long = 2n ** 150000n;
+
+
+function testMultiply(x, y) {
+  return x * y;
+}
+
+
+%PrepareFunctionForOptimization(testMultiply);
+testMultiply(3n, 7n);
+testMultiply(17n, -54n);
+%OptimizeFunctionOnNextCall(testMultiply);
+assertEquals(testMultiply(6n, 2n), 12n);
+%PrepareFunctionForOptimization(testMultiply);
+assertOptimized(testMultiply);
+
+assertEquals(testMultiply(long, long), 2n ** 300000n);
+assertUnoptimized(testMultiply);
+
+%OptimizeFunctionOnNextCall(testMultiply);
+assertEquals(testMultiply(-7n, -12n), 84n);
+assertOptimized(testMultiply);
+
+assertEquals(testMultiply(long, long), 2n ** 300000n);
+assertOptimized(testMultiply);
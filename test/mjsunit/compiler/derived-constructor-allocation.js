@@ -0,0 +1,79 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// An optimized derived class constructor allocates the instance inline for
+// the inlined super() call when new.target is the constructor itself, and
+// falls back to the generic allocation for further subclasses.
+
+class Base {
+  constructor(x) {
+    this.x = x;
+  }
+}
+
+class Derived extends Base {
+  constructor(x, y) {
+    super(x);
+    this.y = y;
+  }
+}
+
+class MoreDerived extends Derived {
+  constructor(x, y, z) {
+    super(x, y);
+    this.z = z;
+  }
+}
+
+(function TestDerived() {
+  %PrepareFunctionForOptimization(Derived);
+  new Derived(1, 2);
+  new Derived(3, 4);
+  %OptimizeFunctionOnNextCall(Derived);
+  const d = new Derived(5, 6);
+  assertEquals(5, d.x);
+  assertEquals(6, d.y);
+  assertSame(Derived.prototype, Object.getPrototypeOf(d));
+  assertTrue(%HaveSameMap(d, new Derived(7, 8)));
+  assertOptimized(Derived);
+})();
+
+(function TestSubclassNewTarget() {
+  const m = new MoreDerived(1, 2, 3);
+  assertEquals(1, m.x);
+  assertEquals(2, m.y);
+  assertEquals(3, m.z);
+  assertSame(MoreDerived.prototype, Object.getPrototypeOf(m));
+  assertInstanceof(m, Derived);
+
+  const r = Reflect.construct(Derived, [4, 5], Array);
+  assertEquals(4, r.x);
+  assertEquals(5, r.y);
+  assertSame(Array.prototype, Object.getPrototypeOf(r));
+  assertOptimized(Derived);
+})();
+
+(function TestInObjectFields() {
+  class Point {
+    constructor(x) {
+      this.x = x;
+    }
+  }
+  class Point3D extends Point {
+    constructor(x, y, z) {
+      super(x);
+      this.y = y;
+      this.z = z;
+    }
+  }
+  %PrepareFunctionForOptimization(Point3D);
+  for (let i = 0; i < 10; i++) new Point3D(i, i, i);
+  %OptimizeFunctionOnNextCall(Point3D);
+  const p = new Point3D(1, 2, 3);
+  assertEquals([1, 2, 3], [p.x, p.y, p.z]);
+  assertTrue(%HasFastProperties(p));
+  assertTrue(%HaveSameMap(p, new Point3D(4, 5, 6)));
+})();
@@ -0,0 +1,66 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape
+
+// Closures and their function contexts that are only called locally should
+// be scalar replaced, and rematerialized correctly on deoptimization.
+
+(function TestInlinedArrayCallback() {
+  function foo(a, k) {
+    return a.map(x => x + k);
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals([2, 3, 4], foo([1, 2, 3], 1));
+  assertEquals([3, 4, 5], foo([1, 2, 3], 2));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals([4, 5, 6], foo([1, 2, 3], 3));
+})();
+
+(function TestClosureCalledThroughProperty() {
+  function foo(k) {
+    const o = {f: x => x * k};
+    return o.f(2) + o.f(3);
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(10, foo(2));
+  assertEquals(15, foo(3));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(20, foo(4));
+})();
+
+(function TestDeoptInsideClosure() {
+  function foo(k, deopt) {
+    const o = {f: x => {
+      if (deopt) %_DeoptimizeNow();
+      return x + k;
+    }};
+    return o.f(1);
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(2, foo(1, false));
+  assertEquals(3, foo(2, false));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(4, foo(3, false));
+  assertEquals(5, foo(4, true));
+})();
+
+(function TestMaterializedClosureStillWorks() {
+  function foo(k, deopt) {
+    const g = x => x + k;
+    const o = {g};
+    if (deopt) %_DeoptimizeNow();
+    return o.g(k) + g(1);
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(4, foo(1, false));
+  assertEquals(7, foo(2, false));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(10, foo(3, false));
+  assertEquals(13, foo(4, true));
+})();
@@ -0,0 +1,69 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+(function TestTypedArraySum() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) s += a[i];
+    return s;
+  }
+  const a = new Float64Array([1, 2, 3, 4]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(10, sum(a));
+  assertEquals(10, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(10, sum(a));
+  assertEquals(3, sum(new Float64Array([1, 2])));
+  assertEquals(0, sum(new Float64Array(0)));
+  assertOptimized(sum);
+})();
+
+(function TestTypedArrayFill() {
+  function fill(a, v) {
+    for (let i = 0; i < a.length; ++i) a[i] = v;
+  }
+  const a = new Int32Array(8);
+  %PrepareFunctionForOptimization(fill);
+  fill(a, 1);
+  fill(a, 2);
+  %OptimizeFunctionOnNextCall(fill);
+  fill(a, 3);
+  assertEquals([3, 3, 3, 3, 3, 3, 3, 3], Array.from(a));
+  assertOptimized(fill);
+})();
+
+(function TestPackedArraySum() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; a.length > i; i++) s += a[i];
+    return s;
+  }
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(6, sum([1, 2, 3]));
+  assertEquals(6, sum([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(6, sum([1, 2, 3]));
+  assertOptimized(sum);
+})();
+
+(function TestShrinkingArray() {
+  // The length is reloaded after the pop(), so the bounds check in the body
+  // must not be eliminated.
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) {
+      a.pop();
+      a.pop();
+      s += a[i] === undefined ? 100 : a[i];
+    }
+    return s;
+  }
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(101, sum([1, 2, 3, 4]));
+  assertEquals(101, sum([1, 2, 3, 4]));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(101, sum([1, 2, 3, 4]));
+})();
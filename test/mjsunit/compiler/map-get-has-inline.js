@@ -0,0 +1,75 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Map.prototype.get and Map.prototype.has probe the table inline for Smi and
+// internalized string keys and fall back to the builtin otherwise.
+
+function get(m, k) { return m.get(k); }
+function has(m, k) { return m.has(k); }
+
+function optimize(f, m, k) {
+  %PrepareFunctionForOptimization(f);
+  f(m, k);
+  f(m, k);
+  %OptimizeFunctionOnNextCall(f);
+  f(m, k);
+}
+
+const m = new Map();
+for (let i = 0; i < 100; i++) {
+  m.set(i, i + 1);
+  m.set('k' + i, -i - 1);
+}
+m.set(1.5, 'double');
+m.set(2 ** 40, 'large');
+const obj = {};
+m.set(obj, 'object');
+
+optimize(get, m, 'k1');
+optimize(has, m, 'k1');
+
+(function TestSmiKeys() {
+  for (let i = 0; i < 100; i++) {
+    assertEquals(i + 1, get(m, i));
+    assertTrue(has(m, i));
+  }
+  assertEquals(undefined, get(m, 100));
+  assertFalse(has(m, -1));
+})();
+
+(function TestInternalizedStringKeys() {
+  assertEquals(-1, get(m, 'k0'));
+  assertEquals(-100, get(m, 'k99'));
+  assertTrue(has(m, 'k42'));
+  assertFalse(has(m, 'k100'));
+  assertEquals(undefined, get(m, 'missing'));
+})();
+
+(function TestNonInternalizedStringKeys() {
+  // Keys stored as non-internalized strings must still be found by content.
+  const m2 = new Map();
+  const prefix = 'some-long-prefix-';
+  for (let i = 0; i < 20; i++) m2.set(prefix + i, i);
+  optimize(get, m2, 'some-long-prefix-3');
+  for (let i = 0; i < 20; i++) {
+    assertEquals(i, get(m2, 'some-long-prefix-' + i));
+    assertEquals(i, get(m2, prefix + i));
+    assertTrue(has(m2, prefix + i));
+  }
+  assertEquals(7, get(m2, 'some-long-prefix-7'));
+  assertFalse(has(m2, 'some-long-prefix-20'));
+})();
+
+(function TestOtherKeys() {
+  assertEquals('double', get(m, 1.5));
+  assertEquals('large', get(m, 2 ** 40));
+  assertEquals('object', get(m, obj));
+  assertEquals(undefined, get(m, {}));
+  assertEquals(2, get(m, 1.0));
+  assertEquals(1, get(m, -0));
+  assertFalse(has(m, NaN));
+  assertFalse(has(m, Symbol()));
+})();
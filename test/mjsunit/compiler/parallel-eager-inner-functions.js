@@ -0,0 +1,54 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --stress-background-compile --parallel-compile-eager-inner-functions
+
+// This script is compiled on a background thread, and its eagerly compiled
+// inner functions (the IIFEs below, and the ones nested in them) are compiled
+// in parallel on worker threads.
+
+var results = [];
+
+(function() {
+  results.push((function(a, b) { return a + b; })(1, 2));
+})();
+
+(function() {
+  var inner = (function() {
+    return (function(x) {
+      return [1, 2, 3].map(y => x * y);
+    })(10);
+  })();
+  results.push(inner.join());
+})();
+
+(function() {
+  class C {
+    constructor(x) { this.x = x; }
+    get twice() { return this.x * 2; }
+  }
+  results.push(new C(21).twice);
+})();
+
+(function() {
+  function* gen() { yield 1; yield 2; }
+  results.push([...gen()].length);
+})();
+
+var asm = (function Module(stdlib) {
+  'use asm';
+  function f(x) {
+    x = x | 0;
+    return (x + 1) | 0;
+  }
+  return {f: f};
+})(this);
+
+(function() {
+  var lazy = function() { return 'lazy'; };
+  results.push(lazy());
+})();
+
+assertEquals([3, '10,20,30', 42, 2, 'lazy'], results);
+assertEquals(42, asm.f(41));
@@ -0,0 +1,81 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --deopt-loop-threshold=1
+
+// Once a property access site has deoptimized, it is compiled as a generic
+// access when it fails its map check again. Each site keeps its own count.
+
+(function TestSingleSite() {
+  function load(o) {
+    return o.x;
+  }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(1, load({x: 1}));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(1, load({x: 1}));
+  assertOptimized(load);
+
+  // First deopt: the IC just learns the new map.
+  assertEquals(2, load({a: 0, x: 2}));
+  assertUnoptimized(load);
+
+  %PrepareFunctionForOptimization(load);
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(1, load({x: 1}));
+  assertOptimized(load);
+
+  // Second deopt at the same site: it gives up on speculation.
+  assertEquals(3, load({b: 0, x: 3}));
+  assertUnoptimized(load);
+
+  %PrepareFunctionForOptimization(load);
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(1, load({x: 1}));
+  assertOptimized(load);
+
+  // New maps are now handled by the generic access.
+  assertEquals(4, load({c: 0, x: 4}));
+  assertEquals(5, load({d: 0, x: 5}));
+  assertOptimized(load);
+})();
+
+(function TestSeparateSites() {
+  function load(o, p) {
+    return o.x + p.y;
+  }
+
+  function reoptimize() {
+    %PrepareFunctionForOptimization(load);
+    %OptimizeFunctionOnNextCall(load);
+    assertEquals(2, load({x: 1}, {y: 1}));
+    assertOptimized(load);
+  }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(2, load({x: 1}, {y: 1}));
+  reoptimize();
+
+  // Make the {o.x} site deopt twice, so that it becomes generic.
+  assertEquals(3, load({a: 0, x: 2}, {y: 1}));
+  assertUnoptimized(load);
+  reoptimize();
+  assertEquals(4, load({b: 0, x: 3}, {y: 1}));
+  assertUnoptimized(load);
+  reoptimize();
+  assertEquals(5, load({c: 0, x: 4}, {y: 1}));
+  assertOptimized(load);
+
+  // The first miss at {p.y} only extends its feedback, so the next new map
+  // there still deopts.
+  assertEquals(3, load({x: 1}, {a: 0, y: 2}));
+  assertUnoptimized(load);
+  reoptimize();
+  assertEquals(3, load({x: 1}, {a: 0, y: 2}));
+  assertOptimized(load);
+  assertEquals(4, load({x: 1}, {b: 0, y: 3}));
+  assertUnoptimized(load);
+})();
@@ -0,0 +1,124 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-inline-proxy-traps
+
+// Named loads and stores on a constant proxy call the get/set trap directly.
+// The proxies live in global variables so that TurboFan sees them as
+// constants.
+
+function optimize(f, ...args) {
+  %PrepareFunctionForOptimization(f);
+  f(...args);
+  f(...args);
+  %OptimizeFunctionOnNextCall(f);
+  return f(...args);
+}
+
+var get_target = {x: 1};
+var get_proxy = new Proxy(get_target, {
+  get(target, name, receiver) {
+    assertSame(get_target, target);
+    assertSame(get_proxy, receiver);
+    return name === 'x' ? target.x * 10 : name;
+  }
+});
+
+(function TestGetTrap() {
+  function f() { return get_proxy.x; }
+  function g() { return get_proxy.foo; }
+  assertEquals(10, optimize(f));
+  assertEquals('foo', optimize(g));
+  assertOptimized(f);
+  get_target.x = 2;
+  assertEquals(20, f());
+  assertOptimized(f);
+})();
+
+var set_log = [];
+var set_target = {};
+var set_result = true;
+var set_proxy = new Proxy(set_target, {
+  set(target, name, value, receiver) {
+    assertSame(set_target, target);
+    assertSame(set_proxy, receiver);
+    set_log.push(name, value);
+    return set_result;
+  }
+});
+
+(function TestSetTrap() {
+  function sloppy(v) { return set_proxy.y = v; }
+  function strict(v) { 'use strict'; return set_proxy.y = v; }
+  assertEquals(1, optimize(sloppy, 1));
+  assertEquals(2, optimize(strict, 2));
+  assertEquals(['y', 1, 'y', 1, 'y', 1, 'y', 2, 'y', 2, 'y', 2], set_log);
+  assertEquals(undefined, set_target.y);
+
+  set_result = 0;
+  assertEquals(3, sloppy(3));
+  assertThrows(() => strict(4), TypeError);
+  assertOptimized(sloppy);
+  set_result = true;
+})();
+
+var frozen_target = {};
+Object.defineProperty(frozen_target, 'z', {value: 1});
+var frozen_result = 1;
+var frozen_proxy = new Proxy(frozen_target, {
+  get() { return frozen_result; },
+  set() { return true; }
+});
+
+(function TestInvariants() {
+  function load() { return frozen_proxy.z; }
+  function store(v) { frozen_proxy.z = v; }
+  assertEquals(1, optimize(load));
+  frozen_result = 2;
+  assertThrows(load, TypeError);
+  optimize(store, 1);
+  assertThrows(() => store(2), TypeError);
+})();
+
+var changing_target = {};
+var define_in_trap = false;
+var changing_proxy = new Proxy(changing_target, {
+  get() {
+    if (define_in_trap) {
+      Object.defineProperty(changing_target, 'w', {value: 1});
+    }
+    return 2;
+  }
+});
+
+(function TestTargetChangedByTrap() {
+  function f() { return changing_proxy.w; }
+  assertEquals(2, optimize(f));
+  define_in_trap = true;
+  assertThrows(f, TypeError);
+})();
+
+var revocable = Proxy.revocable({}, {get() { return 42; }});
+var revocable_proxy = revocable.proxy;
+
+(function TestRevoked() {
+  function f() { return revocable_proxy.v; }
+  assertEquals(42, optimize(f));
+  assertOptimized(f);
+  revocable.revoke();
+  assertThrows(f, TypeError);
+  assertUnoptimized(f);
+})();
+
+var no_trap_target = {u: 5};
+var no_trap_proxy = new Proxy(no_trap_target, {get: undefined});
+
+(function TestNoTrap() {
+  // Without a trap the access is left to the generic path.
+  function f() { return no_trap_proxy.u; }
+  assertEquals(5, optimize(f));
+  assertOptimized(f);
+  no_trap_target.u = 6;
+  assertEquals(6, f());
+})();
@@ -0,0 +1,31 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --turbo-share-optimized-code --turboprop --turboprop-as-midtier
+// Flags: --interrupt-budget=1024 --no-concurrent-recompilation
+
+// Shared TurboFan code isn't used for a closure that asks for Turboprop code.
+
+function make(source) {
+  let context_allocated;
+  return eval(source);
+}
+
+const source = '(function add(a, b) { return a + b; })';
+const f1 = make(source);
+const f2 = make(source);
+%PrepareFunctionForOptimization(f1);
+%PrepareFunctionForOptimization(f2);
+
+// Tier f1 up through Turboprop to TurboFan.
+for (let i = 0; i < 100000; i++) f1(i, 1);
+assertOptimized(f1);
+
+// f2 is still interpreted, so it tiers up to Turboprop first.
+f2(3, 4);
+f2(3, 4);
+%OptimizeFunctionOnNextCall(f2);
+assertEquals(7, f2(3, 4));
+assertOptimized(f2);
@@ -0,0 +1,91 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --turbo-share-optimized-code
+
+// Closures of the same function that have separate feedback vectors share
+// optimized code via the native context, and stop doing so once the code is
+// deoptimized. Evaluating the same source in a fresh function context reuses
+// the SharedFunctionInfos from the eval cache, but not the feedback.
+
+function make(source) {
+  let context_allocated;
+  return eval(source);
+}
+
+function optimize(f, a, b) {
+  %PrepareFunctionForOptimization(f);
+  f(a, b);
+  f(a, b);
+  %OptimizeFunctionOnNextCall(f);
+  return f(a, b);
+}
+
+(function TestShared() {
+  const source = '(function add(a, b) { return a + b; })';
+  const f1 = make(source);
+  const f2 = make(source);
+  const f3 = make(source);
+  assertEquals(3, optimize(f1, 1, 2));
+  assertEquals(7, optimize(f2, 3, 4));
+  assertEquals(11, optimize(f3, 5, 6));
+  assertOptimized(f1);
+  assertOptimized(f2);
+  assertOptimized(f3);
+
+  // Feedback for f3 is for small integers as well, so passing strings to it
+  // deoptimizes the shared code, after which the closures reoptimize on their
+  // own.
+  assertEquals('ab', f3('a', 'b'));
+  assertUnoptimized(f3);
+  assertEquals(3, f2(1, 2));
+  assertEquals('cd', optimize(f2, 'c', 'd'));
+  assertOptimized(f2);
+  assertEquals(3.5, f1(1.5, 2));
+})();
+
+(function TestInnerClosuresKeepSeparateFeedback() {
+  // Optimized code for {outer} embeds the feedback cell for {inner}, so it
+  // is not shared, and each {outer} creates closures with its own feedback.
+  const source =
+      '(function outer() { return function inner(a) { return a + 1; }; })';
+  const outer1 = make(source);
+  const outer2 = make(source);
+  const outer3 = make(source);
+  optimize(outer1);
+  optimize(outer2);
+  optimize(outer3);
+  assertOptimized(outer2);
+  assertOptimized(outer3);
+
+  const inner2 = outer2();
+  const inner3 = outer3();
+  assertEquals(2, optimize(inner2, 1));
+  assertOptimized(inner2);
+
+  // {inner3} has its own feedback vector, without optimized code.
+  assertEquals(3, inner3(2));
+  assertUnoptimized(inner3);
+})();
+
+(function TestCallTargetsAreNotShared() {
+  // Optimized code for {call} checks for the call target from its feedback.
+  // Sharing it would deopt the closures that call other targets, and the
+  // deopt would throw the code away for all of them.
+  const source = '(function call(f) { return f(); })';
+  const call1 = make(source);
+  const call2 = make(source);
+  const call3 = make(source);
+  function one() { return 1; }
+  function two() { return 2; }
+  function three() { return 3; }
+  assertEquals(1, optimize(call1, one));
+  assertEquals(2, optimize(call2, two));
+  assertEquals(3, optimize(call3, three));
+  assertEquals(2, call2(two));
+  assertEquals(3, call3(three));
+  assertOptimized(call2);
+  assertOptimized(call3);
+})();
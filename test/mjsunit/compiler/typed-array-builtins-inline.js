@@ -0,0 +1,141 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-inline-array-builtins
+
+// %TypedArray%.prototype.forEach, reduce, reduceRight, indexOf, includes and
+// fill are inlined by TurboFan.
+
+function optimize(f, ...args) {
+  %PrepareFunctionForOptimization(f);
+  f(...args);
+  f(...args);
+  %OptimizeFunctionOnNextCall(f);
+  return f(...args);
+}
+
+(function TestForEach() {
+  function sum(a) {
+    let s = 0;
+    a.forEach((v, i, o) => {
+      assertSame(a, o);
+      s += v * (i + 1);
+    });
+    return s;
+  }
+  assertEquals(14, optimize(sum, new Int32Array([1, 2, 3])));
+  assertEquals(0, sum(new Int32Array(0)));
+  assertEquals(-1, sum(new Int32Array([-1])));
+  assertOptimized(sum);
+  assertThrows(() => new Int32Array(1).forEach(), TypeError);
+})();
+
+(function TestReduce() {
+  function concat(a) { return a.reduce((acc, v) => acc + v, ''); }
+  function concatRight(a) { return a.reduceRight((acc, v) => acc + v, ''); }
+  function sum(a) { return a.reduce((acc, v) => acc + v); }
+  function sumRight(a) { return a.reduceRight((acc, v) => acc + v); }
+  const a = new Float64Array([0.5, 1, 2]);
+  assertEquals('0.512', optimize(concat, a));
+  assertEquals('210.5', optimize(concatRight, a));
+  assertEquals(3.5, optimize(sum, a));
+  assertEquals(3.5, optimize(sumRight, a));
+  assertEquals(7, sum(new Float64Array([7])));
+  assertThrows(() => sum(new Float64Array(0)), TypeError);
+  assertThrows(() => sumRight(new Float64Array(0)), TypeError);
+  assertEquals('', concat(new Float64Array(0)));
+})();
+
+(function TestIndexOfIncludes() {
+  function indexOf(a, v, from) { return a.indexOf(v, from); }
+  function includes(a, v, from) { return a.includes(v, from); }
+  const a = new Uint8Array([1, 2, 3, 2]);
+  assertEquals(1, optimize(indexOf, a, 2, 0));
+  assertTrue(optimize(includes, a, 3, 0));
+  assertEquals(3, indexOf(a, 2, 2));
+  assertEquals(3, indexOf(a, 2, -1));
+  assertEquals(1, indexOf(a, 2, -10));
+  assertEquals(-1, indexOf(a, 2, 10));
+  assertEquals(-1, indexOf(a, '2', 0));
+  assertEquals(-1, indexOf(a, 258, 0));
+  assertFalse(includes(a, 3, 3));
+  assertFalse(includes(a, undefined, 0));
+
+  const f = new Float32Array([0, -0, NaN]);
+  assertEquals(0, optimize(indexOf, f, -0, 0));
+  assertEquals(-1, indexOf(f, NaN, 0));
+  assertTrue(optimize(includes, f, NaN, 0));
+  assertTrue(includes(f, -0, 1));
+})();
+
+(function TestFill() {
+  function fill(a, v) { return a.fill(v); }
+  function fillFrom(a, v, start) { return a.fill(v, start); }
+  function fillRange(a, v, start, end) { return a.fill(v, start, end); }
+  const a = new Int16Array(4);
+  assertSame(a, optimize(fill, a, 7));
+  assertEquals([7, 7, 7, 7], Array.from(a));
+  assertEquals([7, 1, 1, 1], Array.from(optimize(fillFrom, a, 1, 1)));
+  assertEquals([7, 1, 2, 2], Array.from(fillFrom(a, 2, -2)));
+  assertEquals([3, 3, 3, 3], Array.from(fillFrom(a, 3, -10)));
+  assertEquals([3, 3, 3, 3], Array.from(fillFrom(a, 4, 10)));
+  assertEquals([3, 5, 5, 3], Array.from(optimize(fillRange, a, 5, 1, 3)));
+  assertEquals([3, 5, 6, 3], Array.from(fillRange(a, 6, -2, -1)));
+  assertEquals([3, 5, 6, 3], Array.from(fillRange(a, 7, 3, 1)));
+  assertEquals([8, 8, 8, 8], Array.from(fillRange(a, 8, 0, 10)));
+  assertOptimized(fill);
+  assertOptimized(fillFrom);
+  assertOptimized(fillRange);
+
+  // The value is converted once and then stored with the element type.
+  assertEquals([-1, -1, -1, -1], Array.from(fill(a, 65535)));
+  assertEquals([1, 1, 1, 1], Array.from(fill(a, true)));
+  assertEquals([0, 0, 0, 0], Array.from(fill(a, undefined)));
+  const c = new Uint8ClampedArray(2);
+  assertEquals([255, 255], Array.from(optimize(fill, c, 300)));
+  assertEquals([2, 2], Array.from(fill(c, 1.5)));
+  const f = new Float32Array(2);
+  assertEquals([0.5, 0.5], Array.from(optimize(fill, f, 0.5)));
+  assertEquals([NaN, NaN], Array.from(fill(f, NaN)));
+
+  let conversions = 0;
+  const value = { valueOf() { conversions++; return 9; } };
+  assertEquals([9, 9, 9, 9], Array.from(fill(a, value)));
+  assertEquals(1, conversions);
+})();
+
+(function TestDetachDuringIteration() {
+  function forEach(a) {
+    let n = 0;
+    a.forEach(v => {
+      n++;
+      if (v == 2) %ArrayBufferDetach(a.buffer);
+    });
+    return n;
+  }
+  function reduce(a) {
+    return a.reduce((acc, v) => {
+      if (v == 2) %ArrayBufferDetach(a.buffer);
+      return acc + v;
+    }, 0);
+  }
+  assertEquals(3, optimize(forEach, new Int16Array([1, 3, 5])));
+  assertEquals(2, forEach(new Int16Array([1, 2, 3, 4])));
+  assertEquals(9, optimize(reduce, new Int16Array([1, 3, 5])));
+  assertEquals(3, reduce(new Int16Array([1, 2, 3, 4])));
+})();
+
+(function TestDetachedReceiver() {
+  function forEach(a) { a.forEach(v => v); }
+  function indexOf(a) { return a.indexOf(1); }
+  function fill(a) { return a.fill(1); }
+  optimize(forEach, new Int8Array(4));
+  optimize(indexOf, new Int8Array(4));
+  optimize(fill, new Int8Array(4));
+  const a = new Int8Array(4);
+  %ArrayBufferDetach(a.buffer);
+  assertThrows(() => forEach(a), TypeError);
+  assertThrows(() => indexOf(a), TypeError);
+  assertThrows(() => fill(a), TypeError);
+})();
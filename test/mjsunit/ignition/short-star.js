@@ -0,0 +1,88 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition-short-star --allow-natives-syntax
+
+// Stores to r0..r15 use the Star0..Star15 bytecodes, stores to the other
+// registers keep using Star. Run both in the interpreter, in optimized code
+// and across OSR and deoptimization.
+
+// Enough locals to need registers beyond r15.
+function manyLocals(x) {
+  let a0 = x + 0, a1 = x + 1, a2 = x + 2, a3 = x + 3, a4 = x + 4;
+  let a5 = x + 5, a6 = x + 6, a7 = x + 7, a8 = x + 8, a9 = x + 9;
+  let b0 = a0 * 2, b1 = a1 * 2, b2 = a2 * 2, b3 = a3 * 2, b4 = a4 * 2;
+  let b5 = a5 * 2, b6 = a6 * 2, b7 = a7 * 2, b8 = a8 * 2, b9 = a9 * 2;
+  return a0 + a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8 + a9 +
+         b0 + b1 + b2 + b3 + b4 + b5 + b6 + b7 + b8 + b9;
+}
+
+function expectedManyLocals(x) {
+  return 3 * (10 * x + 45);
+}
+
+(function TestInterpreter() {
+  for (let x = 0; x < 10; x++) {
+    assertEquals(expectedManyLocals(x), manyLocals(x));
+  }
+})();
+
+(function TestOptimized() {
+  %PrepareFunctionForOptimization(manyLocals);
+  assertEquals(expectedManyLocals(1), manyLocals(1));
+  assertEquals(expectedManyLocals(2), manyLocals(2));
+  %OptimizeFunctionOnNextCall(manyLocals);
+  assertEquals(expectedManyLocals(3), manyLocals(3));
+  // Deoptimize back into the interpreter with a non-Smi input.
+  assertEquals(expectedManyLocals(0.5), manyLocals(0.5));
+})();
+
+(function TestOsr() {
+  function f(n) {
+    let sum = 0;
+    let product = 1;
+    for (let i = 0; i < n; i++) {
+      let t = i * 2;
+      sum += t;
+      product = (product * 3) % 1000;
+      if (i == 5) %OptimizeOsr();
+    }
+    return [sum, product];
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals([90, 49], f(10));
+})();
+
+(function TestGenerator() {
+  // Generators save and restore their register file at every yield.
+  function* gen(x) {
+    let a = x + 1;
+    let b = yield a;
+    let c = a + b;
+    yield c;
+    return a + b + c;
+  }
+  const g = gen(1);
+  assertEquals({value: 2, done: false}, g.next());
+  assertEquals({value: 12, done: false}, g.next(10));
+  assertEquals({value: 24, done: true}, g.next());
+})();
+
+(function TestTryCatch() {
+  function f(o) {
+    let result;
+    try {
+      result = o.x.y;
+    } catch (e) {
+      result = e instanceof TypeError;
+    }
+    return result;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(1, f({x: {y: 1}}));
+  assertTrue(f({}));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(2, f({x: {y: 2}}));
+  assertTrue(f({}));
+})();
@@ -0,0 +1,119 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-inline-js-wasm-calls
+
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Calls from optimized JavaScript to exported Wasm functions bypass the
+// JSToWasm wrapper. Check argument conversion, return values, traps and lazy
+// deoptimization while the Wasm function is on the stack.
+
+let deopt_target = null;
+
+const builder = new WasmModuleBuilder();
+const kImportIndex = builder.addImport('m', 'callback', kSig_v_v);
+builder.addFunction('add', kSig_i_ii)
+    .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add])
+    .exportFunc();
+builder.addFunction('div', kSig_i_ii)
+    .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32DivS])
+    .exportFunc();
+builder.addFunction('mulf', kSig_f_ff)
+    .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprF32Mul])
+    .exportFunc();
+builder.addFunction('addd', kSig_d_dd)
+    .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprF64Add])
+    .exportFunc();
+builder.addFunction('nop', kSig_v_i)
+    .addBody([])
+    .exportFunc();
+builder.addFunction('deopt_i', kSig_i_ii)
+    .addBody([
+      kExprCallFunction, kImportIndex,
+      kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add
+    ])
+    .exportFunc();
+builder.addFunction('deopt_d', kSig_d_dd)
+    .addBody([
+      kExprCallFunction, kImportIndex,
+      kExprLocalGet, 0, kExprLocalGet, 1, kExprF64Add
+    ])
+    .exportFunc();
+const instance = builder.instantiate({m: {callback() {
+  if (deopt_target !== null) %DeoptimizeFunction(deopt_target);
+}}});
+const exports = instance.exports;
+
+function optimize(f, ...args) {
+  %PrepareFunctionForOptimization(f);
+  f(...args);
+  f(...args);
+  %OptimizeFunctionOnNextCall(f);
+  return f(...args);
+}
+
+(function TestI32() {
+  function f(a, b) { return exports.add(a, b); }
+  assertEquals(3, optimize(f, 1, 2));
+  assertEquals(-1, f(0x7fffffff, 0x80000000));
+  assertEquals(5, f(2.9, 3.1));
+  assertEquals(1, f(true, null));
+  assertEquals(0, f(undefined, undefined));
+  assertEquals(7, f(7));
+  assertEquals(12, f('5', 7));
+})();
+
+(function TestF32AndF64() {
+  function f(a, b) { return exports.mulf(a, b); }
+  function g(a, b) { return exports.addd(a, b); }
+  assertEquals(6, optimize(f, 2, 3));
+  assertEquals(Math.fround(0.1) * 3, f(0.1, 3));
+  assertEquals(NaN, f(undefined, 1));
+  assertEquals(0.30000000000000004, optimize(g, 0.1, 0.2));
+  assertEquals(Infinity, g(Infinity, 1));
+  assertEquals(-0, g(-0, -0));
+  assertEquals(3.5, g('1.5', 2));
+})();
+
+(function TestVoid() {
+  function f(a) { return exports.nop(a); }
+  assertEquals(undefined, optimize(f, 1));
+  assertEquals(undefined, f({}));
+})();
+
+(function TestTrap() {
+  function f(a, b) { return exports.div(a, b); }
+  assertEquals(2, optimize(f, 4, 2));
+  assertTraps(kTrapDivByZero, () => f(1, 0));
+  function g(a, b) {
+    try {
+      return exports.div(a, b);
+    } catch (e) {
+      return e instanceof WebAssembly.RuntimeError;
+    }
+  }
+  assertEquals(3, optimize(g, 9, 3));
+  assertTrue(g(1, 0));
+})();
+
+(function TestLazyDeoptI32() {
+  function f(a, b) { return exports.deopt_i(a, b) + 1; }
+  assertEquals(4, optimize(f, 1, 2));
+  assertOptimized(f);
+  deopt_target = f;
+  assertEquals(6, f(2, 3));
+  deopt_target = null;
+  assertUnoptimized(f);
+  assertEquals(8, f(3, 4));
+})();
+
+(function TestLazyDeoptF64() {
+  function f(a, b) { return exports.deopt_d(a, b) * 2; }
+  assertEquals(1, optimize(f, 0.25, 0.25));
+  deopt_target = f;
+  assertEquals(3.5, f(0.75, 1));
+  deopt_target = null;
+  assertEquals(4, f(1, 1));
+})();
@@ -45,7 +45,7 @@ class JSCreateLoweringTest : public TypedGraphTest {
                     &machine);
     GraphReducer graph_reducer(zone(), graph(), tick_counter(), broker());
     JSCreateLowering reducer(&graph_reducer, &deps_, &jsgraph, broker(),
-                             zone());
+                             MaybeHandle<JSFunction>(), zone());
     return reducer.Reduce(node);
   }
 
@@ -103,6 +103,75 @@ TEST_F(TypedOptimizationTest, ToBooleanWithAny) {
   ASSERT_FALSE(r.Changed());
 }
 
+// -----------------------------------------------------------------------------
+// CheckBounds
+
+TEST_F(TypedOptimizationTest, CheckBoundsDominatedByLessThan) {
+  Node* index = Parameter(Type::Range(0.0, 1000.0, zone()), 0);
+  Node* length = Parameter(Type::Range(0.0, kMaxSafeInteger, zone()), 1);
+  Node* branch = graph()->NewNode(
+      common()->Branch(),
+      graph()->NewNode(simplified()->NumberLessThan(), index, length),
+      graph()->start());
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* check = graph()->NewNode(
+      simplified()->CheckBounds(FeedbackSource(), CheckBoundsFlags()), index,
+      length, graph()->start(), if_true);
+  NodeProperties::SetType(check, Type::Range(0.0, 1000.0, zone()));
+  Reduction r = Reduce(check);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_THAT(r.replacement(), IsTypeGuard(index, if_true));
+}
+
+TEST_F(TypedOptimizationTest, CheckBoundsDominatedByNegatedLessThanOrEqual) {
+  Node* index = Parameter(Type::Range(0.0, 1000.0, zone()), 0);
+  Node* length = Parameter(Type::Range(0.0, kMaxSafeInteger, zone()), 1);
+  Node* branch = graph()->NewNode(
+      common()->Branch(),
+      graph()->NewNode(simplified()->NumberLessThanOrEqual(), length, index),
+      graph()->start());
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* check = graph()->NewNode(
+      simplified()->CheckBounds(FeedbackSource(), CheckBoundsFlags()), index,
+      length, graph()->start(), if_false);
+  NodeProperties::SetType(check, Type::Range(0.0, 1000.0, zone()));
+  Reduction r = Reduce(check);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_THAT(r.replacement(), IsTypeGuard(index, if_false));
+}
+
+TEST_F(TypedOptimizationTest, CheckBoundsNotDominatedByLessThan) {
+  Node* index = Parameter(Type::Range(0.0, 1000.0, zone()), 0);
+  Node* length = Parameter(Type::Range(0.0, kMaxSafeInteger, zone()), 1);
+  Node* branch = graph()->NewNode(
+      common()->Branch(),
+      graph()->NewNode(simplified()->NumberLessThan(), index, length),
+      graph()->start());
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* check = graph()->NewNode(
+      simplified()->CheckBounds(FeedbackSource(), CheckBoundsFlags()), index,
+      length, graph()->start(), if_false);
+  NodeProperties::SetType(check, Type::Range(0.0, 1000.0, zone()));
+  Reduction r = Reduce(check);
+  ASSERT_FALSE(r.Changed());
+}
+
+TEST_F(TypedOptimizationTest, CheckBoundsWithPossiblyNegativeIndex) {
+  Node* index = Parameter(Type::Range(-1.0, 1000.0, zone()), 0);
+  Node* length = Parameter(Type::Range(0.0, kMaxSafeInteger, zone()), 1);
+  Node* branch = graph()->NewNode(
+      common()->Branch(),
+      graph()->NewNode(simplified()->NumberLessThan(), index, length),
+      graph()->start());
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* check = graph()->NewNode(
+      simplified()->CheckBounds(FeedbackSource(), CheckBoundsFlags()), index,
+      length, graph()->start(), if_true);
+  NodeProperties::SetType(check, Type::Range(0.0, 1000.0, zone()));
+  Reduction r = Reduce(check);
+  ASSERT_FALSE(r.Changed());
+}
+
 }  // namespace typed_optimization_unittest
 }  // namespace compiler
 }  // namespace internal
@@ -155,6 +155,31 @@ TEST_F(ZoneStatsTest, SimpleAllocationLoop) {
   ExpectForPool(0, max_loop_allocation, total_allocated);
 }
 
+TEST_F(ZoneStatsTest, CompressedZones) {
+  ZoneStats::StatsScope stats(zone_stats());
+  size_t compressed = 0;
+  size_t uncompressed = 0;
+  {
+    ZoneStats::Scope graph_scope(zone_stats(), ZONE_NAME, kCompressGraphZone);
+    ZoneStats::Scope temp_scope(zone_stats(), ZONE_NAME);
+    for (int i = 0; i < 10; ++i) {
+      size_t bytes = Allocate(graph_scope.zone());
+      if (kCompressGraphZone) {
+        compressed += bytes;
+      } else {
+        uncompressed += bytes;
+      }
+      uncompressed += Allocate(temp_scope.zone());
+    }
+    ASSERT_EQ(compressed, zone_stats()->GetCurrentCompressedAllocatedBytes());
+    ASSERT_EQ(compressed, stats.GetTotalCompressedAllocatedBytes());
+  }
+  ASSERT_EQ(0u, zone_stats()->GetCurrentCompressedAllocatedBytes());
+  ASSERT_EQ(compressed, zone_stats()->GetTotalCompressedAllocatedBytes());
+  ASSERT_EQ(compressed, stats.GetTotalCompressedAllocatedBytes());
+  ASSERT_EQ(compressed + uncompressed, stats.GetTotalAllocatedBytes());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -54,6 +54,9 @@ class BytecodeArrayWriterUnittest : public TestWithIsolateAndZone {
 
   BytecodeArrayWriter* writer() { return &bytecode_array_writer_; }
   ZoneVector<unsigned char>* bytecodes() { return writer()->bytecodes(); }
+  static ZoneVector<unsigned char>* bytecodes(BytecodeArrayWriter* writer) {
+    return writer->bytecodes();
+  }
   SourcePositionTableBuilder* source_position_table_builder() {
     return writer()->source_position_table_builder();
   }
@@ -361,6 +364,52 @@ TEST_F(BytecodeArrayWriterUnittest, DeadcodeElimination) {
   CHECK(source_iterator.done());
 }
 
+TEST_F(BytecodeArrayWriterUnittest, ShortStar) {
+  // The writer picks up the flag when it is constructed.
+  bool old_flag = FLAG_ignition_short_star;
+  FLAG_ignition_short_star = true;
+  ConstantArrayBuilder constant_array_builder(zone());
+  BytecodeArrayWriter writer(zone(), &constant_array_builder,
+                             SourcePositionTableBuilder::OMIT_SOURCE_POSITIONS);
+  FLAG_ignition_short_star = old_flag;
+
+  static const uint8_t expected_bytes[] = {
+      // clang-format off
+      /*  0 */ B(LdaZero),
+      /*  1 */ B(Star0),
+      /*  2 */ B(Star15),
+      /*  3 */ B(Star), R8(16),
+      /*  5 */ B(Star), R8(200),
+      /*  7 */ B(Wide), B(Star), R16(300),
+      /* 12 */ B(Star), U8(Register::FromParameterIndex(1, 2).ToOperand()),
+      /* 14 */ B(Return),
+      // clang-format on
+  };
+
+  auto write = [&writer](Bytecode bytecode, uint32_t operand) {
+    BytecodeNode node(bytecode, operand);
+    writer.Write(&node);
+  };
+  BytecodeNode lda_zero(Bytecode::kLdaZero);
+  writer.Write(&lda_zero);
+  write(Bytecode::kStar, Register(0).ToOperand());
+  write(Bytecode::kStar, Register(15).ToOperand());
+  write(Bytecode::kStar, Register(16).ToOperand());
+  write(Bytecode::kStar, Register(200).ToOperand());
+  write(Bytecode::kStar, Register(300).ToOperand());
+  write(Bytecode::kStar, Register::FromParameterIndex(1, 2).ToOperand());
+  BytecodeNode ret(Bytecode::kReturn);
+  writer.Write(&ret);
+
+  ZoneVector<unsigned char>* bytes = bytecodes(&writer);
+  CHECK_EQ(bytes->size(), arraysize(expected_bytes));
+  for (size_t i = 0; i < arraysize(expected_bytes); ++i) {
+    CHECK_EQ(static_cast<int>(bytes->at(i)),
+             static_cast<int>(expected_bytes[i]));
+  }
+  CHECK(Register::FromShortStar(Bytecode::kStar15) == Register(15));
+}
+
 #undef B
 #undef R
 
@@ -322,6 +322,40 @@ TEST(Bytecodes, IsJumpIfToBoolean) {
 #undef OR_IS_BYTECODE
 #undef IN_BYTECODE_LIST
 
+TEST(Bytecodes, JumpIfBooleanLookahead) {
+#define TEST_BYTECODE(Name, ...)                                              \
+  if (Bytecodes::IsJumpIfBooleanLookahead(Bytecode::k##Name,                  \
+                                          OperandScale::kSingle)) {           \
+    EXPECT_TRUE(Bytecodes::WritesAccumulator(Bytecode::k##Name));             \
+    EXPECT_FALSE(Bytecodes::IsJump(Bytecode::k##Name));                       \
+    EXPECT_FALSE(Bytecodes::IsStarLookahead(Bytecode::k##Name,                \
+                                            OperandScale::kSingle));          \
+  }                                                                           \
+  EXPECT_FALSE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::k##Name,         \
+                                                   OperandScale::kDouble));
+
+  BYTECODE_LIST(TEST_BYTECODE)
+#undef TEST_BYTECODE
+}
+
+TEST(Bytecodes, ShortStar) {
+  for (int i = 0; i < Bytecodes::kShortStarCount; ++i) {
+    Register reg(i);
+    CHECK(reg.HasShortStar());
+    Bytecode bytecode = reg.ToShortStar();
+    CHECK(Bytecodes::IsShortStar(bytecode));
+    CHECK(Bytecodes::IsAnyStar(bytecode));
+    CHECK_EQ(Bytecodes::Size(bytecode, OperandScale::kSingle), 1);
+    CHECK_EQ(Bytecodes::NumberOfOperands(bytecode), 0);
+    CHECK_EQ(Bytecodes::GetAccumulatorUse(bytecode), AccumulatorUse::kRead);
+    CHECK(Register::FromShortStar(bytecode) == reg);
+  }
+  CHECK(!Register(Bytecodes::kShortStarCount).HasShortStar());
+  CHECK(!Register::FromParameterIndex(0, 1).HasShortStar());
+  CHECK(!Bytecodes::IsShortStar(Bytecode::kStar));
+  CHECK(Bytecodes::IsAnyStar(Bytecode::kStar));
+}
+
 TEST(OperandScale, PrefixesRequired) {
   CHECK(!Bytecodes::OperandScaleRequiresPrefixBytecode(OperandScale::kSingle));
   CHECK(Bytecodes::OperandScaleRequiresPrefixBytecode(OperandScale::kDouble));
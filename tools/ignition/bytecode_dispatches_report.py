@@ -20,7 +20,8 @@ import sys
 
 __DESCRIPTION = """
 Process v8.ignition_dispatches_counters.json and list top counters,
-or plot a dispatch heatmap.
+or plot a dispatch heatmap. Counters from several runs (e.g. of different
+workloads) are summed up when more than one input file is given.
 
 Please note that those handlers that may not or will never dispatch
 (e.g. Return or Throw) do not show up in the results.
@@ -47,6 +48,9 @@ examples:
 
   # Display the top 5 sources and destinations of dispatches to/from LdaZero
   $ tools/ignition/bytecode_dispatches_report.py -f LdaZero -n 5
+
+  # Print the 20 bytecode pairs most worth fusing across two workloads
+  $ tools/ignition/bytecode_dispatches_report.py -c -n 20 a.json b.json
 """
 
 __COUNTER_BITS = struct.calcsize("P") * 8  # Size in bits of a pointer
@@ -79,6 +83,39 @@ def print_top_bytecode_dispatch_pairs(dispatches_table, top_count):
     print("{:>12d}\t{} -> {}".format(counter, source, destination))
 
 
+def merge_dispatches_tables(dispatches_tables):
+  merged_table = {}
+  for dispatches_table in dispatches_tables:
+    for source, counters_from_source in iteritems(dispatches_table):
+      merged_counters = merged_table.setdefault(source, {})
+      for destination, counter in iteritems(counters_from_source):
+        merged_counters[destination] = (
+          merged_counters.get(destination, 0) + counter)
+  return merged_table
+
+
+def find_fusion_candidates(dispatches_table, top_count):
+  # A pair is worth fusing (e.g. by a lookahead in the source handler) if it
+  # is frequent and the source rarely dispatches anywhere else, since every
+  # other dispatch from the source pays for the failed lookahead.
+  def candidates_generator():
+    for source, counters_from_source in iteritems(dispatches_table):
+      total = float(sum(itervalues(counters_from_source)))
+      for destination, counter in iteritems(counters_from_source):
+        yield source, destination, counter, counter / total
+
+  return heapq.nlargest(top_count, candidates_generator(),
+                        key=lambda x: x[2] * x[3])
+
+
+def print_fusion_candidates(dispatches_table, top_count):
+  candidates = find_fusion_candidates(dispatches_table, top_count)
+  print("Top {} bytecode fusion candidates:".format(top_count))
+  for source, destination, counter, ratio in candidates:
+    print("{:>12d}\t{:>5.1f}%\t{} -> {}".format(counter, ratio * 100, source,
+                                               destination))
+
+
 def find_top_bytecodes(dispatches_table):
   top_bytecodes = []
   for bytecode, counters_from_bytecode in iteritems(dispatches_table):
@@ -207,12 +244,18 @@ def parse_command_line():
     action="store_true",
     help="print the top bytecode dispatch pairs"
   )
+  command_line_parser.add_argument(
+    "--fusion-candidates", "-c",
+    action="store_true",
+    help=("print the bytecode dispatch pairs most worth fusing, weighting "
+          "each pair by how often its source dispatches to it")
+  )
   command_line_parser.add_argument(
     "--top-entries-count", "-n",
     metavar="N",
     type=int,
     default=10,
-    help="print N top entries when running with -t or -f (default 10)"
+    help="print N top entries when running with -t, -c or -f (default 10)"
   )
   command_line_parser.add_argument(
     "--top-dispatches-for-bytecode", "-f",
@@ -233,11 +276,11 @@ def parse_command_line():
           "specified bytecode, only applied when using -f")
   )
   command_line_parser.add_argument(
-    "input_filename",
+    "input_filenames",
     metavar="<input filename>",
-    default="v8.ignition_dispatches_table.json",
-    nargs='?',
-    help="Ignition counters JSON file"
+    default=["v8.ignition_dispatches_table.json"],
+    nargs='*',
+    help="Ignition counters JSON files"
   )
 
   return command_line_parser.parse_args()
@@ -254,8 +297,11 @@ def iteritems(d):
 def main():
   program_options = parse_command_line()
 
-  with open(program_options.input_filename) as stream:
-    dispatches_table = json.load(stream)
+  dispatches_tables = []
+  for input_filename in program_options.input_filenames:
+    with open(input_filename) as stream:
+      dispatches_tables.append(json.load(stream))
+  dispatches_table = merge_dispatches_tables(dispatches_tables)
 
   warn_if_counter_may_have_saturated(dispatches_table)
 
@@ -272,6 +318,9 @@ def main():
   elif program_options.top_bytecode_dispatch_pairs:
     print_top_bytecode_dispatch_pairs(
       dispatches_table, program_options.top_entries_count)
+  elif program_options.fusion_candidates:
+    print_fusion_candidates(
+      dispatches_table, program_options.top_entries_count)
   elif program_options.top_dispatches_for_bytecode:
     print_top_dispatch_sources_and_destinations(
       dispatches_table, program_options.top_dispatches_for_bytecode,
@@ -60,3 +60,22 @@ class BytecodeDispatchesReportTest(unittest.TestCase):
       ("a", 2, 0.2),
       ("c", 10, 0.1)
     ])
+
+  def test_merge_dispatches_tables(self):
+    merged_table = bdr.merge_dispatches_tables([
+      {"a": {"a": 1, "b": 2}, "b": {"a": 3}},
+      {"a": {"b": 4, "c": 5}, "c": {"c": 6}}])
+    self.assertDictEqual(merged_table, {
+      "a": {"a": 1, "b": 6, "c": 5},
+      "b": {"a": 3},
+      "c": {"c": 6}})
+
+  def test_find_fusion_candidates(self):
+    candidates = bdr.find_fusion_candidates({
+      "a": {"a": 10, "b": 90},
+      "b": {"a": 50, "b": 50},
+      "c": {"a": 60}}, 3)
+    self.assertListEqual(candidates, [
+      ("a", "b", 90, 0.9),
+      ("c", "a", 60, 1.0),
+      ("b", "a", 50, 0.5)])